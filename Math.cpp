@@ -24,10 +24,10 @@
 
 #include "Meta.hpp"
 
-META_TYPE_AS(Math::Vector1<Math::DefaultFloat>, Vector1, Meta::AddPOD<Type>());
-META_TYPE_AS(Math::Vector2<Math::DefaultFloat>, Vector2, Meta::AddPOD<Type>());
-META_TYPE_AS(Math::Vector3<Math::DefaultFloat>, Vector3, Meta::AddPOD<Type>());
-META_TYPE_AS(Math::Vector4<Math::DefaultFloat>, Vector4, Meta::AddPOD<Type>());
+META_TYPE_AS(Math::Vector1<Math::DefaultFloat>, Vector1, Meta::AddPOD<Type>(), Meta::AddAllFloatMathOps<Type, Type>(), Meta::AddUnaryOp<Type, Meta::kUnaryOperation_Positive>(), Meta::AddUnaryOp<Type, Meta::kUnaryOperation_Negative>());
+META_TYPE_AS(Math::Vector2<Math::DefaultFloat>, Vector2, Meta::AddPOD<Type>(), Meta::AddAllFloatMathOps<Type, Type>(), Meta::AddUnaryOp<Type, Meta::kUnaryOperation_Positive>(), Meta::AddUnaryOp<Type, Meta::kUnaryOperation_Negative>());
+META_TYPE_AS(Math::Vector3<Math::DefaultFloat>, Vector3, Meta::AddPOD<Type>(), Meta::AddAllFloatMathOps<Type, Type>(), Meta::AddUnaryOp<Type, Meta::kUnaryOperation_Positive>(), Meta::AddUnaryOp<Type, Meta::kUnaryOperation_Negative>());
+META_TYPE_AS(Math::Vector4<Math::DefaultFloat>, Vector4, Meta::AddPOD<Type>(), Meta::AddAllFloatMathOps<Type, Type>(), Meta::AddUnaryOp<Type, Meta::kUnaryOperation_Positive>(), Meta::AddUnaryOp<Type, Meta::kUnaryOperation_Negative>());
 
 META_TYPE_AS(Math::Vector1I<Math::DefaultInt>, Vector1I, Meta::AddPOD<Type>());
 META_TYPE_AS(Math::Vector2I<Math::DefaultInt>, Vector2I, Meta::AddPOD<Type>());
@@ -137,7 +137,12 @@ namespace Math
 			return *this;
 		}
 
-		constexpr Vector& operator/=(const Vector& other) { return *this *= (T(1) / other); }
+		constexpr Vector& operator/=(const Vector& other)
+		{
+			for (size_t i = 0; i < Dimension; i++)
+				vec[i] /= other.vec[i];
+			return *this;
+		}
 
 		constexpr       T& operator[](size_t index)       { return vec[index]; }
 		constexpr const T& operator[](size_t index) const { return vec[index]; }
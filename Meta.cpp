@@ -24,10 +24,14 @@
 
 #include <algorithm>
 #include <bit>
+#include <chrono>
+#include <cstring>
 #include <deque>
+#include <fstream>
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <queue>
 
 #include "MetaConfig.hpp"
@@ -44,622 +48,4968 @@ namespace
 
 namespace Meta
 {
-	static Index type_counter = 0;
+	// Number of published types. Everything a reader can reach through an index below this count is fully built.
+	static std::atomic<Index> type_counter = 0;
 
-	template<typename Reservable>
-	static Reservable PreallocateContainer()
+	// Serializes writers. Recursive because registering the first type registers the primitives from inside
+	// Register(). Readers never take it.
+	static std::recursive_mutex& RegistrationMutex()
 	{
-		Reservable result;
-		result.reserve(kPreallocationAmount);
-		return result;
+		static std::recursive_mutex mutex;
+		return mutex;
 	}
 
-	using  InfosContainer = OS::Vector<Information>;
-	static InfosContainer* infos_ptr = nullptr;
-
-	using  NameToIndexContainer = OS::HashMap<Program::Name, Index>;
-	static NameToIndexContainer* name_to_index_ptr = nullptr;
-
-	using  SingletonsContainer = OS::Vector<View>;
-	static SingletonsContainer* singletons_ptr = nullptr;
-
-	using  ConstructorMap = OS::HashMap<FunctionSignature, Constructor>;
-	using  ConstructorsContainer = OS::Vector<ConstructorMap>;
-	static ConstructorsContainer* constructors_ptr = nullptr;
-
-	using  DestructorsContainer = OS::Vector<Destructor>;
-	static DestructorsContainer* destructors_ptr = nullptr;
-
-	using  AssignersMap = OS::HashMap<FunctionSignature, Assigner>;
-	using  AssignersContainer = OS::Vector<AssignersMap>;
-	static AssignersContainer* assigners_ptr = nullptr;
-
-	using  UnaryOpsMap = OS::Vector<OS::HashMap<FunctionSignature, UnaryOperator>>;
-	using  UnaryOpsContainer = OS::Vector<UnaryOpsMap>;
-	static UnaryOpsContainer* unary_ops_ptr = nullptr;
-
-	using  BinaryOpsMap = OS::Vector<OS::HashMap<FunctionSignature, BinaryOperator>>;
-	using  BinaryOpsContainer = OS::Vector<BinaryOpsMap>;
-	static BinaryOpsContainer* binary_ops_ptr = nullptr;
-
-	using  CastersContainer = OS::Vector<OS::Vector<Caster>>;
-	static CastersContainer* casters_ptr = nullptr;
-
-	using  ConvertersContainer = OS::Vector<OS::Vector<Converter>>;
-	static ConvertersContainer* converters_ptr = nullptr;
-}
+	// Copy-on-write table slot. Writers hold the registration lock, copy the current table, change the copy and
+	// publish it with a single release store, so readers get a consistent table from one acquire load. Replaced
+	// tables are kept alive until shutdown since a reader may still be walking one, so every write costs a whole
+	// copy for good: only use it for small tables that change during registration, never for caches that grow
+	// with calls at runtime.
+	template<typename Table>
+	class Published
+	{
+	public:
+		Published() = default;
+		Published(const Published&) = delete;
+		Published(Published&&) = delete;
+		~Published() = default;
 
-NAMEOF_DEF(u8);
-NAMEOF_DEF(u16);
-NAMEOF_DEF(u32);
-NAMEOF_DEF(u64);
-NAMEOF_DEF(i8);
-NAMEOF_DEF(i16);
-NAMEOF_DEF(i32);
-NAMEOF_DEF(i64);
-NAMEOF_DEF(f32);
-NAMEOF_DEF(f64);
-NAMEOF_DEF(bool);
+		Published& operator=(const Published&) = delete;
+		Published& operator=(Published&&) = delete;
 
-using View = Meta::View;
-using Handle = Meta::Handle;
+		const Table& read() const
+		{
+			static const Table empty;
 
-NAMEOF_DEF(View);
-NAMEOF_DEF(Handle);
+			const Table* table = current.load(std::memory_order_acquire);
+			return table ? *table : empty;
+		}
 
-namespace Memory
-{
-	static constexpr std::size_t kMaxSize = std::size_t(std::numeric_limits<Index>::max()) + 1;
+		// A modifier returning false made no change, so its copy is dropped instead of published
+		template<typename Modifier>
+		auto update(Modifier&& modify)
+		{
+			auto next = std::make_unique<Table>(read());
 
-	template<typename T>
-	T* get_allocator(const Meta::Index type)
-	{
-		static OS::Vector<T> spaces;
-		static OS::BitVector used;
+			if constexpr (std::is_void_v<decltype(modify(*next))>)
+			{
+				modify(*next);
+				publish(std::move(next));
+			}
+			else
+			{
+				auto result = modify(*next);
 
-		if (!Meta::Valid(type))
-			return nullptr;
+				if constexpr (std::is_same_v<decltype(result), bool>)
+				{
+					if (!result)
+						return result;
+				}
 
-		if (std::size_t(type) >= used.size())
-		{
-			used.resize(type + 1);
-			spaces.resize(type + 1);
+				publish(std::move(next));
+				return result;
+			}
 		}
 
-		if (!used[type])
+	private:
+		std::atomic<const Table*> current = nullptr;
+		OS::Vector<std::unique_ptr<Table>> versions;
+
+		void publish(std::unique_ptr<Table> next)
 		{
-			spaces[type] = T(type);
-			used[type]  = true;
+			current.store(next.get(), std::memory_order_release);
+			versions.push_back(std::move(next));
 		}
+	};
 
-		return &spaces[type];
-	}
+	using  InfosContainer = OS::StableVector<Information>;
+	static InfosContainer* infos_ptr = nullptr;
 
-	class Pool
+	// Insert-only open addressing from interned names to types. Writers hold the registration lock and grow the
+	// slot array by publishing a rehashed copy; readers probe whichever array is current without locking.
+	class NameToIndexContainer
 	{
 	public:
-		explicit Pool(const Meta::Index type_index = Meta::kInvalidType)
-			: type(type_index)
-		{}
+		[[nodiscard]] Index find(const Program::Name name) const
+		{
+			const Slots* slots = current.load(std::memory_order_acquire);
 
-		~Pool() = default;
+			if (!slots)
+				return kInvalidType;
 
-		Index alloc(const Meta::Spandle& arguments)
-		{
-			const Meta::Information& info = Require(Meta::GetType(type));
-			Index index = kInvalidIndex;
+			const std::size_t mask = slots->size() - 1;
 
-			if (last_deleted != kInvalidIndex)
+			for (std::size_t slot = std::hash<Program::Name>()(name) & mask;; slot = (slot + 1) & mask)
 			{
-				index = last_deleted;
-				const Index next_to_recycle = deleted_jump_table[last_deleted];
+				const Information* info = (*slots)[slot].load(std::memory_order_acquire);
 
-				// Indicate that this element is in use again
-				deleted_jump_table[last_deleted] = kInvalidIndex;
-				// Make the element recycled before this one the next up to be reused
-				last_deleted = next_to_recycle;
+				if (!info)
+					return kInvalidType;
 
-				// If we've reached the first index deleted, mark it as no longer being deleted
-				if (first_deleted == index)
-					first_deleted = kInvalidIndex;
+				if (info->name == name)
+					return info->index;
 			}
-			else if (deleted_jump_table.size() < kMaxSize)
-			{
-				data.resize((num_allocated + 1) * info.size, u8(0));
-				deleted_jump_table.push_back(kInvalidIndex);
-				references.push_back(0);
+		}
 
-				index = Index(deleted_jump_table.size() - 1);
-			}
-			else
-				Program::Assert(false, "Ran out of memory!");
+		void insert(const Information& info)
+		{
+			const Slots* slots = current.load(std::memory_order_relaxed);
 
-			if (index != kInvalidIndex)
+			if (!slots || (count + 1) * 2 > slots->size())
 			{
-				++num_allocated;
-				ref(index);
+				auto grown = std::make_unique<Slots>(slots ? slots->size() * 2 : std::bit_ceil(kPreallocationAmount * 2));
+
+				if (slots)
+				{
+					for (const auto& slot : *slots)
+					{
+						if (const Information* existing = slot.load(std::memory_order_relaxed))
+							place(*grown, *existing);
+					}
+				}
 
-				Meta::ParameterArray memory = { std::make_pair(Meta::kInvalidType, Meta::kQualifier_Temporary) };
-				const Meta::FunctionSignature signature = arguments.get_function_signature(memory);
-				const Meta::Constructor constructor = Meta::GetConstructor(info, signature);
-				constructor(Meta::View(get(index), info, Meta::kQualifier_Reference), arguments);
+				place(*grown, info);
+
+				current.store(grown.get(), std::memory_order_release);
+				versions.push_back(std::move(grown));
 			}
+			else
+				place(*versions.back(), info);
 
-			return index;
+			++count;
 		}
 
-		void ref(const Index index)
-		{
-			if (is_deleted(index))
-				return;
+		[[nodiscard]] bool empty() const { return count == 0; }
+		[[nodiscard]] std::size_t size() const { return count; }
 
-			++references[index];
+		[[nodiscard]] std::size_t capacity() const
+		{
+			const Slots* slots = current.load(std::memory_order_acquire);
+			return slots ? slots->size() : 0;
 		}
 
-		void deref(const Index index)
+		// Publishes a rebuilt copy without the matching entries, since open addressing can't empty a slot in place
+		template<typename Predicate>
+		void erase_if(Predicate&& erased)
 		{
-			if (is_deleted(index))
+			const Slots* slots = current.load(std::memory_order_relaxed);
+
+			if (!slots)
 				return;
 
-			--references[index];
+			auto rebuilt = std::make_unique<Slots>(slots->size());
 
-			if (references[index] == 0)
+			for (const auto& slot : *slots)
 			{
-				deleted_jump_table[index] = last_deleted;
-				last_deleted = index;
-
-				if (first_deleted == kInvalidIndex)
-					first_deleted = index;
+				if (const Information* existing = slot.load(std::memory_order_relaxed))
+				{
+					if (erased(*existing))
+						--count;
+					else
+						place(*rebuilt, *existing);
+				}
+			}
 
-				--num_allocated;
+			current.store(rebuilt.get(), std::memory_order_release);
+			versions.push_back(std::move(rebuilt));
+		}
 
-				const Meta::Information& info = Require(Meta::GetType(type));
+		// Includes the retired slot arrays kept for readers that may still be probing them. Writers only.
+		[[nodiscard]] std::size_t bytes() const
+		{
+			std::size_t total = 0;
 
-				Meta::GetDestructor(info)(View(get(index), info, Meta::kQualifier_Reference));
+			for (const auto& version : versions)
+				total += version->capacity() * sizeof(Slots::value_type);
 
-				std::fill(&data[std::size_t(index) * info.size], &data[std::size_t(index + 1) * info.size], u8());
-			}
+			return total;
 		}
 
-		[[nodiscard]] bool is_valid(const Index index) const
-		{
-			return index > kInvalidIndex && std::size_t(index) < deleted_jump_table.size();
-		}
+	private:
+		using Slots = OS::Vector<std::atomic<const Information*>>;
 
-		void* get(const Index index)
+		static void place(Slots& slots, const Information& info)
 		{
-			return is_valid(index) ? &data[std::size_t(index) * Meta::GetType(type)->size] : nullptr;
-		}
+			const std::size_t mask = slots.size() - 1;
+			std::size_t slot = std::hash<Program::Name>()(info.name) & mask;
 
-		[[nodiscard]] bool is_deleted(const Index index) const
-		{
-			// The first deleted element will have the invalid index as its next jump index
-			// so we need to check for that by seeing if this index is that one
-			return !is_valid(index) || deleted_jump_table[index] != kInvalidIndex || index == first_deleted;
+			while (slots[slot].load(std::memory_order_relaxed))
+				slot = (slot + 1) & mask;
+
+			slots[slot].store(&info, std::memory_order_release);
 		}
 
-	private:
-		OS::Vector<u8> data;
-		OS::Vector<std::size_t> references;
-		OS::Vector<Index> deleted_jump_table;
+		std::atomic<const Slots*> current = nullptr;
+		OS::Vector<std::unique_ptr<Slots>> versions;
+		std::size_t count = 0;
+	};
 
-		Index last_deleted = kInvalidIndex;
-		Index first_deleted = kInvalidIndex;
-		std::size_t num_allocated = 0;
+	static NameToIndexContainer* name_to_index_ptr = nullptr;
 
-		Meta::Index type;
+	// Only touched by writers, to catch two types whose compile-time IDs collide
+	using  TypeIdsContainer = OS::HashMap<TypeId, Index>;
+	static TypeIdsContainer* type_ids_ptr = nullptr;
+
+	// Hash-and-displace minimal perfect hash: a name picks a bucket, the bucket's displacement picks the slot.
+	// Built once registration settles; a probe is two multiplies and a single name compare.
+	struct PerfectNameTable
+	{
+		OS::Vector<u32> displacements;
+		OS::Vector<const Information*> slots;
 	};
 
-	class Heap
+	constinit static Published<PerfectNameTable> perfect_names;
+
+	using  SingletonsContainer = OS::StableVector<Published<View>>;
+	static SingletonsContainer* singletons_ptr = nullptr;
+
+	// Interned signatures form a trie: each ID is its prefix's ID plus one more parameter
+	struct SignatureNode
 	{
-	public:
-		explicit Heap(const Meta::Index type_index = Meta::kInvalidType)
-			: type(type_index)
-		{}
+		SignatureId prefix = kInvalidSignature;
+		Parameter parameter = { kInvalidType, kQualifier_Temporary };
 
-		~Heap()
+		// The whole signature, owned so the bytes it was interned from can go away
+		OS::Vector<Parameter> parameters;
+	};
+
+	// Edges keyed on the prefix ID in the top 24 bits, then the parameter's type and qualifiers. Insert-only open
+	// addressing like the name index: a new node only costs a slot, and the slot array is copied just to grow it.
+	class SignatureEdgesContainer
+	{
+	public:
+		[[nodiscard]] SignatureId find(const u64 edge) const
 		{
-			if (type != Meta::kInvalidType)
+			const Slots* slots = current.load(std::memory_order_acquire);
+
+			if (!slots)
+				return kInvalidSignature;
+
+			const std::size_t mask = slots->size() - 1;
+
+			for (std::size_t slot = Hash(edge) & mask;; slot = (slot + 1) & mask)
 			{
-				const Meta::Information& info = Require(Meta::GetType(type));
-				OS::Memory::Deallocate(data, info.alignment, info.size, capacity);
+				const SignatureId target = (*slots)[slot].target.load(std::memory_order_acquire);
+
+				if (target == kEmptySignature)
+					return kInvalidSignature;
+
+				if ((*slots)[slot].edge.load(std::memory_order_relaxed) == edge)
+					return target;
 			}
 		}
 
-		Range alloc(const std::size_t size, const Meta::Spandle& arguments)
+		void insert(const u64 edge, const SignatureId target)
 		{
-			const Meta::Information& info = Require(Meta::GetType(type));
-			Range result(kInvalidIndex, kInvalidIndex);
+			const Slots* slots = current.load(std::memory_order_relaxed);
 
-			if (queue.size() < kMaxSize)
+			if (!slots || (count + 1) * 2 > slots->size())
 			{
-				if (queue.empty() || queue.top().size() < size)
-				{
-					if (capacity < num_allocated + size)
-						data = OS::Memory::Reallocate(data, info.alignment, info.size, capacity, std::bit_ceil(num_allocated + size));
-
-					used.resize(num_allocated + size, true);
+				auto grown = std::make_unique<Slots>(slots ? slots->size() * 2 : kInitialSlots);
 
-					result.start = Index(num_allocated);
-					result.end = result.start + Index(size);
-				}
-				else
+				if (slots)
 				{
-					result = queue.top();
-					queue.pop();
-					std::fill(std::next(used.begin(), result.start), std::next(used.begin(), result.end), true);
+					for (const Slot& slot : *slots)
+					{
+						if (const SignatureId existing = slot.target.load(std::memory_order_relaxed); existing != kEmptySignature)
+							place(*grown, slot.edge.load(std::memory_order_relaxed), existing);
+					}
 				}
+
+				place(*grown, edge, target);
+
+				current.store(grown.get(), std::memory_order_release);
+				versions.push_back(std::move(grown));
 			}
 			else
-				Program::Assert(false, "Ran out of memory!");
+				place(*versions.back(), edge, target);
 
-			if (result.start != kInvalidIndex && result.end != kInvalidIndex)
-			{
-				num_allocated += size;
+			++count;
+		}
 
-				Meta::ParameterArray memory = { std::make_pair(Meta::kInvalidType, Meta::kQualifier_Temporary) };
-				const Meta::FunctionSignature signature = arguments.get_function_signature(memory);
-				const Meta::Constructor constructor = Meta::GetConstructor(info, signature);
+		[[nodiscard]] std::size_t capacity() const
+		{
+			const Slots* slots = current.load(std::memory_order_acquire);
+			return slots ? slots->size() : 0;
+		}
 
-				for (Index index = result.start; index < result.end; ++index)
-					constructor(Meta::View(get(index), info, Meta::kQualifier_Reference), arguments);
-			}
+		// Includes the retired slot arrays kept for readers that may still be probing them. Writers only.
+		[[nodiscard]] std::size_t bytes() const
+		{
+			std::size_t total = 0;
 
-			return result;
+			for (const auto& version : versions)
+				total += version->capacity() * sizeof(Slot);
+
+			return total;
 		}
 
-		void free(const Range range)
+	private:
+		static constexpr std::size_t kInitialSlots = 64;
+
+		// Every edge leads to a node past the root, so the root's ID marks an empty slot
+		struct Slot
+		{
+			std::atomic<u64> edge = 0;
+			std::atomic<SignatureId> target = kEmptySignature;
+		};
+
+		using Slots = OS::Vector<Slot>;
+
+		// The low bits of an edge hold the qualifiers, so spread the prefix down before masking
+		static std::size_t Hash(const u64 edge)
+		{
+			return std::size_t((edge * 0x9E3779B97F4A7C15ull) >> 32);
+		}
+
+		static void place(Slots& slots, const u64 edge, const SignatureId target)
+		{
+			const std::size_t mask = slots.size() - 1;
+			std::size_t slot = Hash(edge) & mask;
+
+			while (slots[slot].target.load(std::memory_order_relaxed) != kEmptySignature)
+				slot = (slot + 1) & mask;
+
+			slots[slot].edge.store(edge, std::memory_order_relaxed);
+			slots[slot].target.store(target, std::memory_order_release);
+		}
+
+		std::atomic<const Slots*> current = nullptr;
+		OS::Vector<std::unique_ptr<Slots>> versions;
+		std::size_t count = 0;
+	};
+
+	constexpr SignatureId kMaximumSignatures = SignatureId(1) << 24;
+
+	constinit static OS::StableVector<SignatureNode> signature_nodes;
+	constinit static SignatureEdgesContainer signature_edges;
+
+	// Per-type tables hold a handful of signatures, so a flat vector sorted by ID beats hashing
+	template<typename Function>
+	using  SignatureMap = OS::Vector<std::pair<SignatureId, Function>>;
+
+	using  ConstructorMap = SignatureMap<Constructor>;
+	using  ConstructorsContainer = OS::StableVector<Published<ConstructorMap>>;
+	static ConstructorsContainer* constructors_ptr = nullptr;
+
+	using  DestructorsContainer = OS::StableVector<std::atomic<Destructor>>;
+	static DestructorsContainer* destructors_ptr = nullptr;
+
+	using  AssignersMap = SignatureMap<Assigner>;
+	using  AssignersContainer = OS::StableVector<Published<AssignersMap>>;
+	static AssignersContainer* assigners_ptr = nullptr;
+
+	// One per name, sorted by the interned name's address so lookups compare pointers
+	struct MethodSet
+	{
+		Program::Name name;
+		SignatureMap<Method> overloads;
+		SignatureMap<MethodInto> into; // Only the overloads registered with an Into form
+	};
+
+	using  MethodsMap = OS::Vector<MethodSet>;
+	using  MethodsContainer = OS::StableVector<Published<MethodsMap>>;
+	static MethodsContainer* methods_ptr = nullptr;
+
+	// Sorted by the interned name's address, like method sets
+	using  FieldsMap = OS::Vector<Field>;
+	using  FieldsContainer = OS::StableVector<Published<FieldsMap>>;
+	static FieldsContainer* fields_ptr = nullptr;
+
+	using  UnaryOpsMap = std::array<Published<SignatureMap<UnaryOperator>>, kUnaryOperation_Count>;
+	using  UnaryOpsContainer = OS::StableVector<UnaryOpsMap>;
+	static UnaryOpsContainer* unary_ops_ptr = nullptr;
+
+	using  BinaryOpsMap = std::array<Published<SignatureMap<BinaryOperator>>, kBinaryOperation_Count>;
+	using  BinaryOpsContainer = OS::StableVector<BinaryOpsMap>;
+	static BinaryOpsContainer* binary_ops_ptr = nullptr;
+
+	// Into forms, under the same signatures as the operators above, with the type they store
+	template<typename Function>
+	struct OperatorInto
+	{
+		Function function = nullptr;
+		Index result = kInvalidType;
+	};
+
+	using  UnaryOpsIntoMap = std::array<Published<SignatureMap<OperatorInto<UnaryOperatorInto>>>, kUnaryOperation_Count>;
+	using  UnaryOpsIntoContainer = OS::StableVector<UnaryOpsIntoMap>;
+	static UnaryOpsIntoContainer* unary_ops_into_ptr = nullptr;
+
+	using  BinaryOpsIntoMap = std::array<Published<SignatureMap<OperatorInto<BinaryOperatorInto>>>, kBinaryOperation_Count>;
+	using  BinaryOpsIntoContainer = OS::StableVector<BinaryOpsIntoMap>;
+	static BinaryOpsIntoContainer* binary_ops_into_ptr = nullptr;
+
+	// One slot per operation, with the Into form null where the operator has none
+	template<typename Operator, typename Into, std::size_t Count>
+	struct OperatorSlots
+	{
+		std::array<Operator, Count> operators = {};
+		std::array<OperatorInto<Into>, Count> into = {};
+	};
+
+	using  UnarySlots = OperatorSlots<UnaryOperator, UnaryOperatorInto, kUnaryOperation_Count>;
+	using  BinarySlots = OperatorSlots<BinaryOperator, BinaryOperatorInto, kBinaryOperation_Count>;
+
+	// What Apply() dispatches to for a type as the only or left operand
+	struct OperatorRow
+	{
+		UnarySlots unary;
+		BinarySlots same_type;
+		OS::Vector<std::pair<Index, BinarySlots>> mixed_type; // Sorted by the right operand, which is rarely another type
+	};
+
+	// Built on the first dispatch on the type, and rebuilt after its own operator tables change
+	struct OperatorRowSlot
+	{
+		std::atomic<bool> built = false;
+		Published<OperatorRow> row;
+	};
+
+	using  OperatorRowsContainer = OS::StableVector<OperatorRowSlot>;
+	static OperatorRowsContainer* operator_rows_ptr = nullptr;
+
+	// Bumped when a type is registered or a type's constructors, destructor or assigners change, which is all a
+	// Registry context copies. Each type keeps the value from its own last change, so a context only rebuilds for
+	// changes to its own types.
+	static std::atomic<u64> context_generation = 1;
+
+	using  ContextStampsContainer = OS::StableVector<std::atomic<u64>>;
+	static ContextStampsContainer* context_stamps_ptr = nullptr;
+
+	// Writers only
+	static void ContextTablesChanged(const Index type)
+	{
+		Require(context_stamps_ptr)[type].store(context_generation.fetch_add(1, std::memory_order_acq_rel) + 1, std::memory_order_release);
+	}
+
+	using  CastersContainer = OS::StableVector<Published<OS::Vector<Caster>>>;
+	static CastersContainer* casters_ptr = nullptr;
+
+	using  ConvertersContainer = OS::StableVector<Published<OS::Vector<Converter>>>;
+	static ConvertersContainer* converters_ptr = nullptr;
+
+	using  InPlaceConvertersContainer = OS::StableVector<Published<OS::Vector<InPlaceConverter>>>;
+	static InPlaceConvertersContainer* in_place_converters_ptr = nullptr;
+
+	// In-place primitives bind to any qualifiers, so argument signatures mark them with a pair no C++ type has
+	constexpr Qualifier kQualifier_InPlace = kQualifier_Temporary | kQualifier_Reference;
+
+	struct ResolvedOverload
+	{
+		Overload overload;
+		Constructor constructor = nullptr;
+		Assigner assigner = nullptr;
+		Method method = nullptr;
+		MethodInto method_into = nullptr;
+	};
+
+	// Only methods have a name
+	struct OverloadKey
+	{
+		const wchar_t* name = nullptr;
+		Index type = kInvalidType;
+		SignatureId arguments = kInvalidSignature;
+		OverloadSet set = kOverloadSet_Count;
+
+		bool operator==(const OverloadKey&) const = default;
+	};
+
+	struct OverloadKeyHash
+	{
+		std::size_t operator()(const OverloadKey& key) const
+		{
+			u64 mixed = u64(reinterpret_cast<std::uintptr_t>(key.name)) ^ ((u64(u32(key.type)) << 32 | key.arguments) * 0x9E3779B97F4A7C15ull) ^ key.set;
+
+			mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ull;
+			mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBull;
+			return std::size_t(mixed ^ (mixed >> 31));
+		}
+	};
+
+	using  LazyContainer = OS::StableVector<Published<OS::Vector<Populator>>>;
+	static LazyContainer* lazy_ptr = nullptr;
+
+	// Deferred registration bookkeeping for ReportLazy()
+	static std::atomic<std::size_t> lazy_pending_types = 0;
+	static std::atomic<std::size_t> lazy_populated_types = 0;
+	static std::atomic<u64> lazy_populate_nanoseconds = 0;
+	static std::atomic<u64> register_nanoseconds = 0;
+
+	struct ProfileEntry
+	{
+		u64 nanoseconds = 0;
+		std::size_t allocations = 0;
+		u32 calls = 0;
+	};
+
+	using ProfileRow = std::array<ProfileEntry, kProfile_Count>;
+
+	struct Module
+	{
+		OS::SharedLibrary library;
+		OS::Vector<Index> types;
+	};
+
+	// Writers only. A module's ID is its position plus one.
+	constinit static OS::Vector<Module> modules;
+	constinit static ModuleId loading_module = kInvalidModule;
+
+	// Types of unloaded modules. Writers only.
+	constinit static OS::Vector<bool> retired_types;
+
+	// Fills the perfect name table slots of retired types, which must not be empty and must not match their names
+	constinit static const Information kRetiredInformation;
+
+	static bool IsRetiredUnlocked(const Index type)
+	{
+		return std::size_t(type) < retired_types.size() && retired_types[type];
+	}
+
+	// Types whose bases came from a snapshot of this build, so AddInheritance() has nothing left to do. Writers only.
+	constinit static OS::Vector<bool> snapshot_bases;
+
+	// Separate from the registration lock since META_TYPE initializers record outside of it
+	constinit static std::mutex profile_mutex;
+	constinit static OS::Vector<ProfileRow> profiles;
+
+	ProfileMark ProfileNow()
+	{
+		if constexpr (!kRegistrationProfiling)
+			return {};
+
+		const auto now = std::chrono::steady_clock::now().time_since_epoch();
+		return { u64(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count()), OS::Memory::GetStats().allocations };
+	}
+
+	void AddProfile(const Index type, const ProfileCategory category, const ProfileMark& start)
+	{
+		if constexpr (!kRegistrationProfiling)
+			return;
+
+		if (type < 0 || category >= kProfile_Count)
+			return;
+
+		const ProfileMark end = ProfileNow();
+		const std::lock_guard lock(profile_mutex);
+
+		if (profiles.size() <= std::size_t(type))
+			profiles.resize(type + 1);
+
+		ProfileEntry& entry = profiles[type][category];
+
+		entry.nanoseconds += end.nanoseconds - start.nanoseconds;
+		entry.allocations += end.allocations - start.allocations;
+		++entry.calls;
+	}
+
+	// Times the enclosing Add*() call
+	class ProfileScope
+	{
+	public:
+		ProfileScope(const Index profiled_type, const ProfileCategory profiled_category)
+			: type(profiled_type)
+			, category(profiled_category)
+			, start(ProfileNow())
+		{}
+
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope(ProfileScope&&) = delete;
+
+		~ProfileScope()
+		{
+			AddProfile(type, category, start);
+		}
+
+		ProfileScope& operator=(const ProfileScope&) = delete;
+		ProfileScope& operator=(ProfileScope&&) = delete;
+
+	private:
+		Index type;
+		ProfileCategory category;
+		ProfileMark start;
+	};
+
+	// Only invoked methods have a name
+	struct DispatchKey
+	{
+		Index type = kInvalidType;
+		Index other = kInvalidType;
+		Program::Name name;
+		u32 detail = 0;
+		DispatchOperation operation = kDispatch_Count;
+
+		bool operator==(const DispatchKey& key) const
+		{
+			return type == key.type && other == key.other && name.data() == key.name.data() && detail == key.detail && operation == key.operation;
+		}
+	};
+
+	struct DispatchKeyHash
+	{
+		std::size_t operator()(const DispatchKey& key) const
+		{
+			u64 mixed = u64(reinterpret_cast<std::uintptr_t>(key.name.data())) ^ ((u64(u32(key.type)) << 32 | key.detail) * 0x9E3779B97F4A7C15ull) ^ (u64(key.other) << 8 | key.operation);
+
+			mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ull;
+			mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBull;
+			return std::size_t(mixed ^ (mixed >> 31));
+		}
+	};
+
+	// Only the owning thread writes a slot, while CollectDispatchProfile() may read it at any time. The key is written
+	// once, before used is set.
+	struct DispatchSlot
+	{
+		std::atomic<bool> used = false;
+		DispatchKey key;
+		std::atomic<u64> calls = 0;
+		std::atomic<u64> samples = 0;
+		std::atomic<u64> nanoseconds = 0;
+		std::array<std::atomic<u64>, kDispatchHistogramBuckets> histogram = {};
+	};
+
+	// Open addressed, and never rehashed so readers can walk it while its thread keeps counting
+	struct DispatchTable
+	{
+		std::array<DispatchSlot, kDispatchProfileSlots> slots;
+		std::atomic<u64> dropped = 0;
+		std::size_t countdown = kDispatchProfileSampleRate;
+	};
+
+	using DispatchPositions = std::unordered_map<DispatchKey, std::size_t, DispatchKeyHash, std::equal_to<DispatchKey>, OS::Memory::Allocator<std::pair<const DispatchKey, std::size_t>>>;
+
+	constinit static std::mutex dispatch_profile_mutex;
+	constinit static OS::Vector<DispatchTable*> dispatch_tables; // Of the running threads
+	constinit static OS::Vector<DispatchProfile> retired_dispatch_profiles; // Merged from threads that have exited
+	constinit static u64 retired_dispatch_dropped = 0;
+
+	// Single writer, so a plain load and store is enough and cheaper than an atomic add
+	static void Bump(std::atomic<u64>& counter, const u64 amount)
+	{
+		counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+	}
+
+	static void MergeDispatchTable(const DispatchTable& table, OS::Vector<DispatchProfile>& profiles, DispatchPositions& positions)
+	{
+		for (const DispatchSlot& slot : table.slots)
+		{
+			if (!slot.used.load(std::memory_order_acquire))
+				continue;
+
+			const auto [iterator, inserted] = positions.try_emplace(slot.key, profiles.size());
+
+			if (inserted)
+				profiles.push_back({ .type = slot.key.type, .other = slot.key.other, .name = slot.key.name, .operation = slot.key.operation, .detail = slot.key.detail });
+
+			DispatchProfile& profile = profiles[iterator->second];
+
+			profile.calls += slot.calls.load(std::memory_order_relaxed);
+			profile.samples += slot.samples.load(std::memory_order_relaxed);
+			profile.nanoseconds += slot.nanoseconds.load(std::memory_order_relaxed);
+
+			for (std::size_t bucket = 0; bucket < kDispatchHistogramBuckets; ++bucket)
+				profile.histogram[bucket] += slot.histogram[bucket].load(std::memory_order_relaxed);
+		}
+	}
+
+	static DispatchPositions PositionsOf(const OS::Vector<DispatchProfile>& profiles)
+	{
+		DispatchPositions positions;
+
+		for (std::size_t position = 0; position < profiles.size(); ++position)
+		{
+			const DispatchProfile& profile = profiles[position];
+			positions.emplace(DispatchKey{ profile.type, profile.other, profile.name, profile.detail, profile.operation }, position);
+		}
+
+		return positions;
+	}
+
+	// Registers the thread's table on its first dispatch, and folds it into the retired profiles when the thread exits
+	class DispatchTableOwner
+	{
+	public:
+		DispatchTableOwner() = default;
+
+		DispatchTableOwner(const DispatchTableOwner&) = delete;
+		DispatchTableOwner(DispatchTableOwner&&) = delete;
+
+		~DispatchTableOwner()
+		{
+			if (!table)
+				return;
+
+			const std::lock_guard lock(dispatch_profile_mutex);
+
+			DispatchPositions positions = PositionsOf(retired_dispatch_profiles);
+			MergeDispatchTable(*table, retired_dispatch_profiles, positions);
+
+			retired_dispatch_dropped += table->dropped.load(std::memory_order_relaxed);
+			std::erase(dispatch_tables, table.get());
+		}
+
+		DispatchTableOwner& operator=(const DispatchTableOwner&) = delete;
+		DispatchTableOwner& operator=(DispatchTableOwner&&) = delete;
+
+		DispatchTable& get()
+		{
+			if (!table) [[unlikely]]
+			{
+				table = std::make_unique<DispatchTable>();
+
+				const std::lock_guard lock(dispatch_profile_mutex);
+				dispatch_tables.push_back(table.get());
+			}
+
+			return *table;
+		}
+
+	private:
+		std::unique_ptr<DispatchTable> table;
+	};
+
+	static DispatchTable& ThreadDispatchTable()
+	{
+		thread_local DispatchTableOwner owner;
+		return owner.get();
+	}
+
+	// Counts one dispatch on this thread. Null if profiling is off or the thread's table is full.
+	static DispatchSlot* CountDispatch(DispatchTable& table, const DispatchKey& key)
+	{
+		if constexpr (!kDispatchProfiling)
+			return nullptr;
+
+		std::size_t index = DispatchKeyHash()(key) % kDispatchProfileSlots;
+
+		for (std::size_t probe = 0; probe < kDispatchProfileSlots; ++probe, index = (index + 1) % kDispatchProfileSlots)
+		{
+			DispatchSlot& slot = table.slots[index];
+
+			if (!slot.used.load(std::memory_order_relaxed))
+			{
+				slot.key = key;
+				slot.used.store(true, std::memory_order_release);
+			}
+			else if (!(slot.key == key))
+			{
+				continue;
+			}
+
+			Bump(slot.calls, 1);
+			return &slot;
+		}
+
+		Bump(table.dropped, 1);
+		return nullptr;
+	}
+
+	static void CountDispatch(const DispatchKey& key)
+	{
+		if constexpr (kDispatchProfiling)
+			CountDispatch(ThreadDispatchTable(), key);
+	}
+
+	// Counts the enclosing dispatch, and times it when the thread's turn to sample comes around
+	class DispatchScope
+	{
+	public:
+		explicit DispatchScope(const DispatchKey& key)
+		{
+			if constexpr (kDispatchProfiling)
+			{
+				DispatchTable& table = ThreadDispatchTable();
+
+				slot = CountDispatch(table, key);
+
+				if (slot && --table.countdown == 0)
+				{
+					table.countdown = kDispatchProfileSampleRate;
+					start = std::chrono::steady_clock::now();
+				}
+				else
+				{
+					slot = nullptr;
+				}
+			}
+		}
+
+		DispatchScope(const DispatchScope&) = delete;
+		DispatchScope(DispatchScope&&) = delete;
+
+		~DispatchScope()
+		{
+			if constexpr (kDispatchProfiling)
+			{
+				if (!slot)
+					return;
+
+				const u64 nanoseconds = u64(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+
+				Bump(slot->samples, 1);
+				Bump(slot->nanoseconds, nanoseconds);
+				Bump(slot->histogram[std::min<std::size_t>(std::bit_width(nanoseconds), kDispatchHistogramBuckets - 1)], 1);
+			}
+		}
+
+		DispatchScope& operator=(const DispatchScope&) = delete;
+		DispatchScope& operator=(DispatchScope&&) = delete;
+
+	private:
+		DispatchSlot* slot = nullptr; // Only while sampled
+		std::chrono::steady_clock::time_point start;
+	};
+
+	// Interval numbering over the forest of each type's first (primary) base: a type's ancestors along primary
+	// bases are exactly the types whose [pre, post] range holds its own pre number. Under multiple inheritance a type
+	// also keeps the sorted pre numbers of the deepest types it reaches through secondary bases, and every other
+	// ancestor encloses one of those.
+	struct HierarchyNode
+	{
+		u32 pre = 0;
+		u32 post = 0;
+		u32 anchors_offset = 0;
+		u32 anchors_count = 0;
+	};
+
+	struct Hierarchy
+	{
+		OS::Vector<HierarchyNode> nodes;
+		OS::Vector<u32> anchors;
+	};
+
+	// Direct bases per type in declaration order, the first being the primary. Writers only.
+	constinit static OS::Vector<OS::Vector<Index>> direct_bases;
+
+	// Renumbered on the first query after AddInheritance() changes direct_bases
+	constinit static Published<Hierarchy> hierarchy;
+	static std::atomic<bool> hierarchy_stale = false;
+
+	template<typename Function>
+	struct FrozenEntry
+	{
+		SignatureId signature = kInvalidSignature;
+		Function function = nullptr;
+	};
+
+	// Structure-of-arrays snapshot of the registry, indexed by Index. The hot tables are what allocation and
+	// dispatch touch per object; everything else stays in the cold Information copies.
+	struct FrozenTables
+	{
+		OS::CacheVector<std::size_t> sizes;
+		OS::CacheVector<std::size_t> alignments;
+		OS::CacheVector<Destructor>  destructors;
+		OS::CacheVector<Constructor> default_constructors;
+		OS::CacheVector<Constructor> copy_constructors;
+		OS::CacheVector<Constructor> move_constructors;
+
+		// Per-type ranges [offsets[i], offsets[i + 1]) into the flat signature tables
+		OS::CacheVector<u32> constructor_offsets;
+		OS::CacheVector<FrozenEntry<Constructor>> constructors;
+		OS::CacheVector<u32> assigner_offsets;
+		OS::CacheVector<FrozenEntry<Assigner>> assigners;
+
+		OS::Vector<Information> infos;
+		Hierarchy hierarchy;
+	};
+
+	// Set after the frozen tables are published. Thaw() only clears it: a reader that saw it set may still be reading
+	// the tables, so every version is kept until shutdown like the Published ones. Writers only touch the versions.
+	static std::atomic<bool> frozen = false;
+	constinit static std::atomic<const FrozenTables*> frozen_tables = nullptr;
+	constinit static OS::Vector<std::unique_ptr<FrozenTables>> frozen_versions;
+
+	// Only valid once frozen has been seen set
+	static const FrozenTables& Frozen()
+	{
+		return *frozen_tables.load(std::memory_order_acquire);
+	}
+
+	// Bumped by every change a DispatchCache, the overload memo or the visible methods memo could have copied, so they
+	// know to drop it
+	static std::atomic<u64> registry_generation = 1;
+
+	// Per-thread memo of results that hold until the registry generation moves on, like a DispatchCache for the
+	// searches behind runtime lookups. A hit takes no lock and a miss copies nothing. Entries are freed once the
+	// generation moves on, and a full memo stops taking new ones until then, so it never outgrows
+	// kResolutionMemoEntries however many distinct keys show up.
+	template<typename Key, typename Value, typename Hash = std::hash<Key>>
+	class ThreadMemo
+	{
+	public:
+		// Calls use with the memoized value for key, computing it on a miss
+		template<typename Compute, typename Use>
+		auto with(const Key& key, Compute&& compute, Use&& use)
+		{
+			const u64 generation = registry_generation.load(std::memory_order_acquire);
+
+			// An outer use() on this thread may still hold an entry, so the old ones wait until it returns
+			if (generation != current && users == 0)
+			{
+				Entries().swap(entries);
+				current = generation;
+			}
+
+			if (generation == current)
+			{
+				if (const auto iterator = entries.find(key); iterator != entries.end()) [[likely]]
+					return Call(*this, use, iterator->second);
+			}
+
+			Value value = compute();
+
+			// A search that populated a type moved the generation on, so its result may already be stale
+			if (generation == current && entries.size() < kResolutionMemoEntries && registry_generation.load(std::memory_order_acquire) == generation)
+				return Call(*this, use, entries.emplace(key, std::move(value)).first->second);
+
+			return Call(*this, use, value);
+		}
+
+	private:
+		using Entries = std::unordered_map<Key, Value, Hash, std::equal_to<Key>, OS::Memory::Allocator<std::pair<const Key, Value>>>;
+
+		template<typename Function>
+		static auto Call(ThreadMemo& memo, Function& use, const Value& value)
+		{
+			struct Scope
+			{
+				ThreadMemo& memo;
+
+				explicit Scope(ThreadMemo& memo) : memo(memo) { ++memo.users; }
+				~Scope() { --memo.users; }
+
+				Scope(const Scope&) = delete;
+				Scope(Scope&&) = delete;
+				Scope& operator=(const Scope&) = delete;
+				Scope& operator=(Scope&&) = delete;
+			};
+
+			const Scope scope(memo);
+			return use(value);
+		}
+
+		Entries entries;
+		u64 current = 0;
+		u32 users = 0;
+	};
+
+	using  OverloadMemo = ThreadMemo<OverloadKey, ResolvedOverload, OverloadKeyHash>;
+
+	static OverloadMemo& ThreadOverloadMemo()
+	{
+		thread_local OverloadMemo memo;
+		return memo;
+	}
+
+	// Casters to apply in order from one type to another, or empty if there is no path. Pairs with a direct caster
+	// never get here.
+	using  CastPathMemo = ThreadMemo<u64, OS::Vector<Caster>>;
+
+	static CastPathMemo& ThreadCastPathMemo()
+	{
+		thread_local CastPathMemo memo;
+		return memo;
+	}
+
+	// Likewise for converter chains, where an invalid plan means there is no chain
+	using  ConversionPlanMemo = ThreadMemo<u64, ConversionPlan>;
+
+	static ConversionPlanMemo& ThreadConversionPlanMemo()
+	{
+		thread_local ConversionPlanMemo memo;
+		return memo;
+	}
+
+	// What by-name lookups on a type see, its own method sets merged with those of its bases
+	using  VisibleMethodsMemo = ThreadMemo<Index, MethodsMap>;
+
+	static VisibleMethodsMemo& ThreadVisibleMethodsMemo()
+	{
+		thread_local VisibleMethodsMemo memo;
+		return memo;
+	}
+
+	// Maps a 32-bit hash onto [0, range) without a division
+	static u32 ReduceRange(const u32 hash, const u32 range)
+	{
+		return u32((u64(hash) * u64(range)) >> 32);
+	}
+
+	static u32 PerfectNameBucket(const std::size_t hash, const std::size_t num_buckets)
+	{
+		return ReduceRange(u32(u64(hash) >> 32), u32(num_buckets));
+	}
+
+	static u32 PerfectNameSlot(const std::size_t hash, const u32 displacement, const std::size_t num_slots)
+	{
+		u64 mixed = u64(hash) + u64(displacement) * 0x9E3779B97F4A7C15ull;
+
+		mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ull;
+		mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBull;
+		mixed ^= mixed >> 31;
+
+		return ReduceRange(u32(mixed), u32(num_slots));
+	}
+
+	static bool IsFrozenFast()
+	{
+		return frozen.load(std::memory_order_acquire);
+	}
+
+	static void RequireMutable()
+	{
+		Program::Assert(!IsFrozenFast(), "The registry is frozen!");
+	}
+
+	static u64 SignatureEdge(const SignatureId prefix, const Parameter parameter)
+	{
+		return (u64(prefix) << 40) | (u64(u32(parameter.first)) << 8) | u64(parameter.second);
+	}
+
+	SignatureId ExtendSignature(const SignatureId prefix, const Parameter parameter)
+	{
+		return signature_edges.find(SignatureEdge(prefix, parameter));
+	}
+
+	SignatureId FindSignature(const FunctionSignature signature)
+	{
+		SignatureId id = kEmptySignature;
+
+		for (std::size_t offset = 0; offset < signature.size() && id != kInvalidSignature; offset += sizeof(Parameter))
+		{
+			Parameter parameter;
+			std::memcpy(static_cast<void*>(&parameter), signature.data() + offset, sizeof(Parameter));
+
+			id = ExtendSignature(id, parameter);
+		}
+
+		return id;
+	}
+
+	SignatureId InternSignature(const FunctionSignature signature)
+	{
+		const std::lock_guard lock(RegistrationMutex());
+
+		if (signature_nodes.empty()) [[unlikely]]
+			signature_nodes.emplace_back();
+
+		SignatureId id = kEmptySignature;
+
+		for (std::size_t offset = 0; offset < signature.size(); offset += sizeof(Parameter))
+		{
+			Parameter parameter;
+			std::memcpy(static_cast<void*>(&parameter), signature.data() + offset, sizeof(Parameter));
+
+			if (const SignatureId next = ExtendSignature(id, parameter); next != kInvalidSignature)
+			{
+				id = next;
+				continue;
+			}
+
+			const SignatureId next = SignatureId(signature_nodes.size());
+			Program::Assert(next < kMaximumSignatures, "Too many signatures!");
+
+			SignatureNode& node = signature_nodes.emplace_back(SignatureNode{ .prefix = id, .parameter = parameter, .parameters = signature_nodes[id].parameters });
+			node.parameters.push_back(parameter);
+
+			// The node is visible before the edge leading to it
+			signature_edges.insert(SignatureEdge(id, parameter), next);
+
+			id = next;
+		}
+
+		return id;
+	}
+
+	FunctionSignature GetSignature(const SignatureId signature)
+	{
+		if (std::size_t(signature) >= signature_nodes.size())
+			return {};
+
+		const auto& parameters = signature_nodes[signature].parameters;
+		return { reinterpret_cast<const char*>(parameters.data()), parameters.size() * sizeof(Parameter) };
+	}
+
+	// Whether the signature is exactly one parameter of the given type and qualifiers
+	static bool IsSingleParameter(const SignatureId signature, const Index type, const Qualifier qualifier_flags)
+	{
+		if (signature == kEmptySignature || std::size_t(signature) >= signature_nodes.size())
+			return false;
+
+		const SignatureNode& node = signature_nodes[signature];
+		return node.prefix == kEmptySignature && node.parameter.first == type && node.parameter.second == qualifier_flags;
+	}
+
+	template<typename Function>
+	static Function FindBySignature(const SignatureMap<Function>& map, const SignatureId signature)
+	{
+		const auto iterator = std::lower_bound(map.begin(), map.end(), signature, [](const auto& entry, const SignatureId id) { return entry.first < id; });
+		return iterator != map.end() && iterator->first == signature ? iterator->second : Function{};
+	}
+
+	template<typename Function>
+	static bool InsertBySignature(SignatureMap<Function>& map, const SignatureId signature, const Function function)
+	{
+		const auto iterator = std::lower_bound(map.begin(), map.end(), signature, [](const auto& entry, const SignatureId id) { return entry.first < id; });
+
+		if (iterator != map.end() && iterator->first == signature)
+			return false;
+
+		map.insert(iterator, { signature, function });
+		return true;
+	}
+
+	template<typename Function>
+	static Function FindFrozen(const OS::CacheVector<u32>& offsets, const OS::CacheVector<FrozenEntry<Function>>& entries, const Index type, const SignatureId signature)
+	{
+		const auto end = entries.begin() + offsets[type + 1];
+		const auto iterator = std::lower_bound(entries.begin() + offsets[type], end, signature, [](const auto& entry, const SignatureId id) { return entry.signature < id; });
+
+		return iterator != end && iterator->signature == signature ? iterator->function : nullptr;
+	}
+
+	// The slot is the type's row in the tables, which differs from its index in a Registry context
+	static Constructor FindFrozenConstructor(const FrozenTables& tables, const Index slot, const Index type, const SignatureId signature)
+	{
+		if (signature == kEmptySignature)
+			return tables.default_constructors[slot];
+		if (IsSingleParameter(signature, type, kQualifier_Constant | kQualifier_Reference))
+			return tables.copy_constructors[slot];
+		if (IsSingleParameter(signature, type, kQualifier_Temporary))
+			return tables.move_constructors[slot];
+
+		return FindFrozen(tables.constructor_offsets, tables.constructors, slot, signature);
+	}
+
+	// Null when no constructor takes exactly these parameters, which leaves it to the overload resolver
+	static Constructor FindConstructor(const Information& info, const SignatureId signature)
+	{
+		if (IsFrozenFast()) [[likely]]
+			return FindFrozenConstructor(Frozen(), info.index, info.index, signature);
+
+		return FindBySignature(Require(constructors_ptr)[info.index].read(), signature);
+	}
+
+	static std::size_t SizeOf(const Index type)
+	{
+		if (IsFrozenFast()) [[likely]]
+			return Frozen().sizes[type];
+
+		return Require(infos_ptr)[type].size;
+	}
+
+	static Index PrimaryBaseOf(const Index type)
+	{
+		return std::size_t(type) < direct_bases.size() && !direct_bases[type].empty() ? direct_bases[type].front() : kInvalidType;
+	}
+
+	static bool Encloses(const HierarchyNode& ancestor, const HierarchyNode& descendant)
+	{
+		// Intervals nest, so holding the descendant's pre number is enough
+		return descendant.pre - ancestor.pre <= ancestor.post - ancestor.pre;
+	}
+
+	struct HierarchyBuilder
+	{
+		const Hierarchy& result;
+		OS::Vector<u32> post_by_pre;
+		OS::Vector<OS::Vector<u32>> anchors;
+		OS::Vector<u8> states;
+
+		// The type's own pre number plus those of the deepest types it inherits from, memoized per type
+		const OS::Vector<u32>& AnchorsOf(const Index type)
+		{
+			static constexpr u8 kState_Done = 2;
+			static constexpr u8 kState_Visiting = 1;
+
+			// Also breaks inheritance cycles
+			if (states[type] != 0)
+				return anchors[type];
+
+			states[type] = kState_Visiting;
+
+			OS::Vector<u32> found;
+			found.push_back(result.nodes[type].pre);
+
+			if (std::size_t(type) < direct_bases.size())
+			{
+				for (const Index base : direct_bases[type])
+				{
+					const OS::Vector<u32>& base_anchors = AnchorsOf(base);
+					found.insert(found.end(), base_anchors.begin(), base_anchors.end());
+				}
+			}
+
+			std::sort(found.begin(), found.end());
+			found.erase(std::unique(found.begin(), found.end()), found.end());
+
+			// Descendants follow right after a type in pre order, and an anchor enclosing another adds nothing
+			std::size_t kept = 0;
+
+			for (std::size_t anchor = 0; anchor < found.size(); ++anchor)
+			{
+				if (anchor + 1 == found.size() || found[anchor + 1] > post_by_pre[found[anchor]])
+					found[kept++] = found[anchor];
+			}
+
+			found.resize(kept);
+
+			anchors[type] = std::move(found);
+			states[type] = kState_Done;
+
+			return anchors[type];
+		}
+	};
+
+	// Writers only
+	static Hierarchy BuildHierarchy()
+	{
+		const std::size_t count = type_counter.load(std::memory_order_relaxed);
+
+		Hierarchy result;
+		OS::Vector<OS::Vector<Index>> children(count);
+		OS::BitVector visited(count, false);
+
+		result.nodes.resize(count);
+
+		for (Index type = 0; type < Index(count); ++type)
+		{
+			if (const Index primary = PrimaryBaseOf(type); primary != kInvalidType)
+				children[primary].push_back(type);
+		}
+
+		u32 counter = 0;
+		OS::Vector<std::pair<Index, std::size_t>> stack;
+
+		const auto number = [&](const Index root)
+		{
+			visited[root] = true;
+			result.nodes[root].pre = counter++;
+			stack.emplace_back(root, 0);
+
+			while (!stack.empty())
+			{
+				auto& [node, next_child] = stack.back();
+
+				if (next_child < children[node].size())
+				{
+					const Index child = children[node][next_child++];
+
+					if (!visited[child])
+					{
+						visited[child] = true;
+						result.nodes[child].pre = counter++;
+						stack.emplace_back(child, 0);
+					}
+				}
+				else
+				{
+					result.nodes[node].post = counter++;
+					stack.pop_back();
+				}
+			}
+		};
+
+		for (Index type = 0; type < Index(count); ++type)
+		{
+			if (PrimaryBaseOf(type) == kInvalidType)
+				number(type);
+		}
+
+		// Only types caught in an inheritance cycle are left
+		for (Index type = 0; type < Index(count); ++type)
+		{
+			if (!visited[type])
+				number(type);
+		}
+
+		HierarchyBuilder builder{ result, OS::Vector<u32>(counter), OS::Vector<OS::Vector<u32>>(count), OS::Vector<u8>(count, 0) };
+
+		for (const HierarchyNode& node : result.nodes)
+			builder.post_by_pre[node.pre] = node.post;
+
+		for (Index type = 0; type < Index(count); ++type)
+		{
+			HierarchyNode& node = result.nodes[type];
+			node.anchors_offset = u32(result.anchors.size());
+
+			// The type's own anchor is covered by the interval test
+			for (const u32 anchor : builder.AnchorsOf(type))
+			{
+				if (anchor != node.pre)
+					result.anchors.push_back(anchor);
+			}
+
+			node.anchors_count = u32(result.anchors.size()) - node.anchors_offset;
+		}
+
+		return result;
+	}
+
+	static const Hierarchy& CurrentHierarchy()
+	{
+		if (hierarchy_stale.load(std::memory_order_acquire)) [[unlikely]]
+		{
+			const std::lock_guard lock(RegistrationMutex());
+
+			if (hierarchy_stale.load(std::memory_order_relaxed))
+			{
+				hierarchy.update([](Hierarchy& current)
+				{
+					current = BuildHierarchy();
+					return true;
+				});
+
+				hierarchy_stale.store(false, std::memory_order_release);
+			}
+		}
+
+		return hierarchy.read();
+	}
+
+	// Whether base is a strict ancestor of derived
+	static bool InheritsFrom(const Index derived, const Index base)
+	{
+		const Hierarchy& current = IsFrozenFast() ? Frozen().hierarchy : CurrentHierarchy();
+
+		if (derived == base || std::size_t(derived) >= current.nodes.size() || std::size_t(base) >= current.nodes.size())
+			return false;
+
+		const HierarchyNode& node = current.nodes[derived];
+		const HierarchyNode& base_node = current.nodes[base];
+
+		// Mostly single inheritance, so avoid branching on the outcome itself
+		const bool primary = Encloses(base_node, node);
+
+		if (node.anchors_count == 0) [[likely]]
+			return primary;
+
+		const auto anchors_begin = std::next(current.anchors.begin(), node.anchors_offset);
+		const auto anchors_end = std::next(anchors_begin, node.anchors_count);
+		const u32 base_range = base_node.post - base_node.pre;
+
+		static constexpr u32 kLinearAnchors = 16;
+
+		if (node.anchors_count <= kLinearAnchors)
+		{
+			bool secondary = false;
+
+			for (auto anchor = anchors_begin; anchor != anchors_end; ++anchor)
+				secondary |= *anchor - base_node.pre <= base_range;
+
+			return primary | secondary;
+		}
+
+		const auto anchor = std::lower_bound(anchors_begin, anchors_end, base_node.pre);
+		return primary || (anchor != anchors_end && *anchor - base_node.pre <= base_range);
+	}
+}
+
+NAMEOF_DEF(u8);
+NAMEOF_DEF(u16);
+NAMEOF_DEF(u32);
+NAMEOF_DEF(u64);
+NAMEOF_DEF(i8);
+NAMEOF_DEF(i16);
+NAMEOF_DEF(i32);
+NAMEOF_DEF(i64);
+NAMEOF_DEF(f32);
+NAMEOF_DEF(f64);
+NAMEOF_DEF(bool);
+
+using View = Meta::View;
+using Handle = Meta::Handle;
+
+NAMEOF_DEF(View);
+NAMEOF_DEF(Handle);
+
+namespace Memory
+{
+	static constexpr std::size_t kMaxSize = std::size_t(std::numeric_limits<Index>::max()) + 1;
+
+	template<typename T>
+	struct Allocators
+	{
+		OS::Vector<T> spaces;
+		OS::BitVector used;
+	};
+
+	template<typename T>
+	Allocators<T>& all_allocators()
+	{
+		static Allocators<T> allocators;
+		return allocators;
+	}
+
+	template<typename T>
+	T* get_allocator(const Meta::Index type)
+	{
+		auto& [spaces, used] = all_allocators<T>();
+
+		if (!Meta::Valid(type))
+			return nullptr;
+
+		if (std::size_t(type) >= used.size())
+		{
+			used.resize(type + 1);
+			spaces.resize(type + 1);
+		}
+
+		if (!used[type])
+		{
+			spaces[type] = T(type);
+			used[type]  = true;
+		}
+
+		return &spaces[type];
+	}
+
+	// Null until something is allocated for the type, unlike get_allocator()
+	template<typename T>
+	const T* find_allocator(const Meta::Index type)
+	{
+		const auto& [spaces, used] = all_allocators<T>();
+		return type >= 0 && std::size_t(type) < used.size() && used[type] ? &spaces[type] : nullptr;
+	}
+
+	class Pool
+	{
+	public:
+		explicit Pool(const Meta::Index type_index = Meta::kInvalidType)
+			: type(type_index)
+		{
+			if (type != Meta::kInvalidType)
+			{
+				const Meta::Information& info = Require(Meta::GetType(type));
+
+				slot_size = info.size;
+				slot_alignment = info.alignment;
+			}
+		}
+
+		Pool(const Pool&) = delete;
+		Pool(Pool&&) noexcept = default;
+
+		~Pool()
+		{
+			for (std::size_t segment = 0; segment < segments.size(); ++segment)
+				OS::Memory::Deallocate(segments[segment], slot_alignment, slot_size, SegmentSlots(segment));
+		}
+
+		Pool& operator=(const Pool&) = delete;
+
+		Pool& operator=(Pool&& other) noexcept
+		{
+			if (this != &other)
+			{
+				std::destroy_at(this);
+				std::construct_at(this, std::move(other));
+			}
+
+			return *this;
+		}
+
+		Index alloc(const Meta::Spandle& arguments)
+		{
+			const Meta::Information& info = Require(Meta::GetType(type));
+			Index index = kInvalidIndex;
+
+			if (last_deleted != kInvalidIndex)
+			{
+				index = last_deleted;
+				const Index next_to_recycle = deleted_jump_table[last_deleted];
+
+				// Indicate that this element is in use again
+				deleted_jump_table[last_deleted] = kInvalidIndex;
+				// Make the element recycled before this one the next up to be reused
+				last_deleted = next_to_recycle;
+
+				// If we've reached the first index deleted, mark it as no longer being deleted
+				if (first_deleted == index)
+					first_deleted = kInvalidIndex;
+			}
+			else if (deleted_jump_table.size() < kMaxSize)
+			{
+				if (deleted_jump_table.size() == capacity())
+				{
+					const std::size_t slots = SegmentSlots(segments.size());
+					void* segment = OS::Memory::Allocate(slot_alignment, slot_size, slots);
+
+					std::memset(segment, 0, slots * slot_size);
+					segments.push_back(static_cast<u8*>(segment));
+				}
+
+				deleted_jump_table.push_back(kInvalidIndex);
+				references.push_back(0);
+
+				index = Index(deleted_jump_table.size() - 1);
+			}
+			else
+				Program::Assert(false, "Ran out of memory!");
+
+			if (index != kInvalidIndex)
+			{
+				++num_allocated;
+				ref(index);
+
+				const Meta::SignatureId signature = arguments.get_signature_id();
+				const Meta::Constructor constructor = constructors.get(type, signature, [&] { return Meta::FindConstructor(info, signature); });
+
+				if (constructor) [[likely]]
+					constructor(Meta::View(get(index), info, Meta::kQualifier_Reference), arguments);
+				else
+					Meta::Construct(info, Meta::View(get(index), info, Meta::kQualifier_Reference), arguments);
+			}
+
+			return index;
+		}
+
+		void ref(const Index index)
+		{
+			if (is_deleted(index))
+				return;
+
+			++references[index];
+		}
+
+		void deref(const Index index)
+		{
+			if (is_deleted(index))
+				return;
+
+			--references[index];
+
+			if (references[index] == 0)
+			{
+				deleted_jump_table[index] = last_deleted;
+				last_deleted = index;
+
+				if (first_deleted == kInvalidIndex)
+					first_deleted = index;
+
+				--num_allocated;
+
+				const Meta::Information& info = Require(Meta::GetType(type));
+
+				Meta::GetDestructor(info)(View(get(index), info, Meta::kQualifier_Reference));
+
+				std::memset(get(index), 0, slot_size);
+			}
+		}
+
+		[[nodiscard]] bool is_valid(const Index index) const
+		{
+			return index > kInvalidIndex && std::size_t(index) < deleted_jump_table.size();
+		}
+
+		void* get(const Index index)
+		{
+			if (!is_valid(index))
+				return nullptr;
+
+			const auto [segment, offset] = Locate(std::size_t(index));
+			return segments[segment] + offset * slot_size;
+		}
+
+		[[nodiscard]] bool is_deleted(const Index index) const
+		{
+			// The first deleted element will have the invalid index as its next jump index
+			// so we need to check for that by seeing if this index is that one
+			return !is_valid(index) || deleted_jump_table[index] != kInvalidIndex || index == first_deleted;
+		}
+
+		void stats(Meta::TypeStats& type_stats) const
+		{
+			type_stats.live_objects = num_allocated;
+			type_stats.pool_slots = deleted_jump_table.size();
+			type_stats.pool_bytes = capacity() * slot_size + references.capacity() * sizeof(std::size_t) + deleted_jump_table.capacity() * sizeof(Index);
+		}
+
+	private:
+		// Segment s holds kPreallocationAmount << s slots
+		static std::size_t SegmentSlots(const std::size_t segment)
+		{
+			return Meta::kPreallocationAmount << segment;
+		}
+
+		static std::pair<std::size_t, std::size_t> Locate(const std::size_t index)
+		{
+			const std::size_t segment = std::size_t(std::bit_width(index / Meta::kPreallocationAmount + 1) - 1);
+			return { segment, index - Meta::kPreallocationAmount * ((std::size_t(1) << segment) - 1) };
+		}
+
+		[[nodiscard]] std::size_t capacity() const
+		{
+			return Meta::kPreallocationAmount * ((std::size_t(1) << segments.size()) - 1);
+		}
+
+		// Slots never move once allocated, so Views into them stay valid as the pool grows
+		OS::Vector<u8*> segments;
+		std::size_t slot_size = 0;
+		std::size_t slot_alignment = 0;
+
+		OS::Vector<std::size_t> references;
+		OS::Vector<Index> deleted_jump_table;
+
+		Index last_deleted = kInvalidIndex;
+		Index first_deleted = kInvalidIndex;
+		std::size_t num_allocated = 0;
+
+		Meta::Index type;
+		Meta::DispatchCache<Meta::Constructor> constructors;
+	};
+
+	class Heap
+	{
+	public:
+		explicit Heap(const Meta::Index type_index = Meta::kInvalidType)
+			: type(type_index)
+		{}
+
+		Heap(const Heap&) = delete;
+
+		// The moved-from heap gives up its block so only one of them frees it
+		Heap(Heap&& other) noexcept
+			: data(std::exchange(other.data, nullptr))
+			, capacity(std::exchange(other.capacity, 0))
+			, used(std::move(other.used))
+			, queue(std::move(other.queue))
+			, num_allocated(std::exchange(other.num_allocated, 0))
+			, type(std::exchange(other.type, Meta::kInvalidType))
+			, constructors(other.constructors)
+		{}
+
+		~Heap()
+		{
+			if (type != Meta::kInvalidType)
+			{
+				const Meta::Information& info = Require(Meta::GetType(type));
+				OS::Memory::Deallocate(data, info.alignment, info.size, capacity);
+			}
+		}
+
+		Heap& operator=(const Heap&) = delete;
+
+		Heap& operator=(Heap&& other) noexcept
+		{
+			if (this != &other)
+			{
+				std::destroy_at(this);
+				std::construct_at(this, std::move(other));
+			}
+
+			return *this;
+		}
+
+		Range alloc(const std::size_t size, const Meta::Spandle& arguments)
+		{
+			const Meta::Information& info = Require(Meta::GetType(type));
+			Range result(kInvalidIndex, kInvalidIndex);
+
+			if (queue.size() < kMaxSize)
+			{
+				if (queue.empty() || queue.top().size() < size)
+				{
+					// Past every slot handed out so far, which freed ranges below still count towards
+					const std::size_t end = used.size();
+
+					if (capacity < end + size)
+						data = OS::Memory::Reallocate(data, info.alignment, info.size, capacity, std::bit_ceil(end + size));
+
+					used.resize(end + size, true);
+
+					result.start = Index(end);
+					result.end = result.start + Index(size);
+				}
+				else
+				{
+					const Range block = queue.top();
+					queue.pop();
+
+					result = Range(block.start, block.start + Index(size));
+					std::fill(std::next(used.begin(), result.start), std::next(used.begin(), result.end), true);
+
+					// The rest of a bigger block goes back for later
+					if (result.end < block.end)
+						queue.push(Range(result.end, block.end));
+				}
+			}
+			else
+				Program::Assert(false, "Ran out of memory!");
+
+			if (result.start != kInvalidIndex && result.end != kInvalidIndex)
+			{
+				num_allocated += size;
+
+				const Meta::SignatureId signature = arguments.get_signature_id();
+				const Meta::Constructor constructor = constructors.get(type, signature, [&] { return Meta::FindConstructor(info, signature); });
+
+				for (Index index = result.start; index < result.end; ++index)
+				{
+					if (constructor) [[likely]]
+						constructor(Meta::View(get(index), info, Meta::kQualifier_Reference), arguments);
+					else
+						Meta::Construct(info, Meta::View(get(index), info, Meta::kQualifier_Reference), arguments);
+				}
+			}
+
+			return result;
+		}
+
+		void free(const Range range)
+		{
+			if (range.empty())
+				return;
+
+			const Meta::Information& info = Require(Meta::GetType(type));
+
+			for (Index index = range.start; index < range.end; ++index)
+				Meta::GetDestructor(info)(View(get(index), info, Meta::kQualifier_Reference));
+
+			std::fill(std::next(used.begin(), range.start), std::next(used.begin(), range.end), false);
+			queue.push(range);
+
+			num_allocated -= range.size();
+		}
+
+		void* get(const Index index)
+		{
+			return used[index] ? static_cast<u8*>(data) + (std::size_t(index) * Meta::SizeOf(type)) : nullptr;
+		}
+
+		void stats(Meta::TypeStats& type_stats) const
+		{
+			// Freed ranges keep their slots marked unused until they are handed out again
+			const auto free_slots = std::size_t(std::count(used.begin(), used.end(), false));
+
+			type_stats.heap_live = num_allocated;
+			type_stats.heap_slots = capacity;
+			type_stats.heap_bytes = capacity * Meta::SizeOf(type);
+			type_stats.heap_free_ranges = queue.size();
+			type_stats.heap_largest_free_range = queue.empty() ? 0 : queue.top().size();
+			type_stats.heap_fragmentation = free_slots > 0 ? 1.0 - (double(type_stats.heap_largest_free_range) / double(free_slots)) : 0.0;
+		}
+
+	private:
+		void* data = nullptr;
+		std::size_t capacity = 0;
+
+		OS::BitVector used;
+		std::priority_queue<Range, std::deque<Range, OS::Memory::Allocator<Range>>, RangeComparator> queue;
+
+		std::size_t num_allocated = 0;
+
+		Meta::Index type;
+		Meta::DispatchCache<Meta::Constructor> constructors;
+	};
+}
+
+namespace Meta
+{
+	// Runs whatever AddLazy() deferred for the type. Populated types only pay for one acquire load.
+	static void Populate(const Index type)
+	{
+		auto& pending = Require(lazy_ptr)[type];
+
+		if (pending.read().empty()) [[likely]]
+			return;
+
+		const ProfileScope profile(type, kProfile_Lazy);
+		const std::lock_guard lock(RegistrationMutex());
+
+		// Copied since the populators below may publish a new list for this type
+		const OS::Vector<Populator> populators = pending.read();
+
+		if (populators.empty())
+			return;
+
+		const auto start = std::chrono::steady_clock::now();
+
+		for (const Populator populator : populators)
+			Program::Assert(populator(), "Error in lazy registration process!");
+
+		// Only cleared once the tables are filled, so a reader that sees an empty list also sees the entries
+		pending.update([](OS::Vector<Populator>& list)
+		{
+			list.clear();
+			return true;
+		});
+
+		const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+		lazy_pending_types.fetch_sub(1, std::memory_order_relaxed);
+		lazy_populated_types.fetch_add(1, std::memory_order_relaxed);
+		lazy_populate_nanoseconds.fetch_add(u64(elapsed.count()), std::memory_order_relaxed);
+	}
+
+	const Information& Register(const Program::Name name, const std::size_t alignment, const std::size_t size, const TypeId id)
+	{
+		static InfosContainer       infos;
+		static NameToIndexContainer name_to_index;
+		static SingletonsContainer  singletons;
+
+		static CastersContainer     casters;
+		static ConvertersContainer  converters;
+		static InPlaceConvertersContainer in_place_converters;
+
+		static ConstructorsContainer constructors;
+		static DestructorsContainer  destructors;
+		static AssignersContainer    assigners;
+		static MethodsContainer      methods;
+		static FieldsContainer       fields;
+		static UnaryOpsContainer     unary_ops;
+		static BinaryOpsContainer    binary_ops;
+		static UnaryOpsIntoContainer  unary_ops_into;
+		static BinaryOpsIntoContainer binary_ops_into;
+		static OperatorRowsContainer operator_rows;
+		static ContextStampsContainer context_stamps;
+		static LazyContainer         lazy;
+		static TypeIdsContainer      type_ids;
+
+		static bool initialized = false;
+
+		const ProfileMark profile_start = ProfileNow();
+		const auto start = std::chrono::steady_clock::now();
+		const std::lock_guard lock(RegistrationMutex());
+
+		if (!initialized) [[unlikely]]
+		{
+			// Must be set before calls below to prevent the recursion from going any further
+			initialized = true;
+
+			infos_ptr = &infos;
+			name_to_index_ptr = &name_to_index;
+			singletons_ptr = &singletons;
+
+			casters_ptr = &casters;
+			converters_ptr = &converters;
+			in_place_converters_ptr = &in_place_converters;
+
+			constructors_ptr = &constructors;
+			destructors_ptr = &destructors;
+			assigners_ptr = &assigners;
+			methods_ptr = &methods;
+			fields_ptr = &fields;
+			unary_ops_ptr = &unary_ops;
+			binary_ops_ptr = &binary_ops;
+			unary_ops_into_ptr = &unary_ops_into;
+			binary_ops_into_ptr = &binary_ops_into;
+			operator_rows_ptr = &operator_rows;
+			context_stamps_ptr = &context_stamps;
+			lazy_ptr = &lazy;
+			type_ids_ptr = &type_ids;
+
+			Program::Assert(AddPrimitiveIntegralType<u8>(),  "Error in initializing u8 into the Meta system!");
+			Program::Assert(AddPrimitiveIntegralType<u16>(), "Error in initializing u16 into the Meta system!");
+			Program::Assert(AddPrimitiveIntegralType<u32>(), "Error in initializing u32 into the Meta system!");
+			Program::Assert(AddPrimitiveIntegralType<u64>(), "Error in initializing u64 into the Meta system!");
+			Program::Assert(AddPrimitiveIntegralType<i8>(),  "Error in initializing i8 into the Meta system!");
+			Program::Assert(AddPrimitiveIntegralType<i16>(), "Error in initializing i16 into the Meta system!");
+			Program::Assert(AddPrimitiveIntegralType<i32>(), "Error in initializing i32 into the Meta system!");
+			Program::Assert(AddPrimitiveIntegralType<i64>(), "Error in initializing i64 into the Meta system!");
+			Program::Assert(AddPrimitiveFloatType<f32>(),    "Error in initializing f32 into the Meta system!");
+			Program::Assert(AddPrimitiveFloatType<f64>(),    "Error in initializing f64 into the Meta system!");
+			Program::Assert(AddPOD<bool>(),                  "Error in initializing bool into the Meta system!");
+			Program::Assert(AddPOD<View>(),                  "Error in initializing View into the Meta system!");
+			Program::Assert(AddPOD<Handle>(),                "Error in initializing Handle into the Meta system!");
+
+			if constexpr (kSnapshotPath != nullptr)
+				LoadSnapshot(kSnapshotPath);
+		}
+
+		if (const Index existing = name_to_index.find(name); existing != kInvalidType)
+			return infos[existing];
+
+		RequireMutable();
+
+		const Index index = type_counter.load(std::memory_order_relaxed);
+
+		if (id != kInvalidTypeId)
+			Program::Assert(type_ids.try_emplace(id, index).second, "Type ID collision, rename one of the types!");
+
+		// Every per-type slot is built before the type count is bumped, so a reader that sees a valid index
+		// never sees a missing table
+		const Information& info = infos.emplace_back(Information
+			{
+				  .index = index
+				, .name = name
+				, .alignment = alignment
+				, .size = size
+				, .id = id
+			}
+		);
+
+		singletons.emplace_back();
+
+		casters.emplace_back();
+		converters.emplace_back();
+		in_place_converters.emplace_back();
+
+		constructors.emplace_back();
+		destructors.emplace_back(nullptr);
+		assigners.emplace_back();
+		methods.emplace_back();
+		fields.emplace_back();
+		unary_ops.emplace_back();
+		binary_ops.emplace_back();
+		unary_ops_into.emplace_back();
+		binary_ops_into.emplace_back();
+		operator_rows.emplace_back();
+		context_stamps.emplace_back(0);
+		lazy.emplace_back();
+
+		name_to_index.insert(info);
+		type_counter.store(index + 1, std::memory_order_release);
+		registry_generation.fetch_add(1, std::memory_order_release);
+		context_generation.fetch_add(1, std::memory_order_release);
+
+		if (loading_module != kInvalidModule)
+			modules[loading_module - 1].types.push_back(index);
+
+		AddProfile(index, kProfile_Register, profile_start);
+
+		const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+		register_nanoseconds.fetch_add(u64(elapsed.count()), std::memory_order_relaxed);
+
+		return info;
+	}
+
+	// Bootstrap the primitives during static initialization, before any other thread can race it, so
+	// the registration lock is never held while waiting on another type's Info<T>() initialization
+	[[maybe_unused]] static const bool bootstrapped = (Info<bool>(), true);
+
+	Index Find(const Program::Name name)
+	{
+		const PerfectNameTable& table = perfect_names.read();
+
+		if (!table.slots.empty()) [[likely]]
+		{
+			const std::size_t hash = std::hash<Program::Name>()(name);
+			const u32 displacement = table.displacements[PerfectNameBucket(hash, table.displacements.size())];
+			const Information* info = table.slots[PerfectNameSlot(hash, displacement, table.slots.size())];
+
+			if (info->name == name) [[likely]]
+				return info->index;
+		}
+
+		return Require(name_to_index_ptr).find(name);
+	}
+
+	bool BuildPerfectNameTable()
+	{
+		static constexpr u32 kMaxDisplacement = 1u << 24;
+
+		const std::lock_guard lock(RegistrationMutex());
+
+		const auto& infos = Require(infos_ptr);
+
+		// A retired type's name may be registered again by a reloaded module, and two equal names can't be separated
+		OS::Vector<Index> live;
+		live.reserve(infos.size());
+
+		for (std::size_t type = 0; type < infos.size(); ++type)
+		{
+			if (!IsRetiredUnlocked(Index(type)))
+				live.push_back(Index(type));
+		}
+
+		const std::size_t count = live.size();
+
+		if (count == 0 || count > std::numeric_limits<u32>::max())
+			return false;
+
+		const std::size_t num_buckets = (count + kPerfectHashBucketSize - 1) / kPerfectHashBucketSize;
+
+		OS::Vector<std::size_t> hashes(infos.size());
+		OS::Vector<OS::Vector<Index>> buckets(num_buckets);
+
+		for (const Index type : live)
+		{
+			hashes[type] = std::hash<Program::Name>()(infos[type].name);
+			buckets[PerfectNameBucket(hashes[type], num_buckets)].push_back(type);
+		}
+
+		// Placing the largest buckets first, while most slots are still free, keeps the displacement search short
+		OS::Vector<u32> order(num_buckets);
+
+		for (u32 bucket = 0; bucket < u32(num_buckets); ++bucket)
+			order[bucket] = bucket;
+
+		std::stable_sort(order.begin(), order.end(), [&](const u32 a, const u32 b) { return buckets[a].size() > buckets[b].size(); });
+
+		PerfectNameTable table;
+		OS::Vector<u32> bucket_slots;
+
+		table.displacements.resize(num_buckets, 0);
+		table.slots.resize(count, nullptr);
+
+		for (const u32 bucket : order)
+		{
+			if (buckets[bucket].empty())
+				break;
+
+			u32 displacement = 0;
+
+			for (;; ++displacement)
+			{
+				if (displacement == kMaxDisplacement)
+					return false;
+
+				bucket_slots.clear();
+
+				bool placed = true;
+
+				for (const Index type : buckets[bucket])
+				{
+					const u32 slot = PerfectNameSlot(hashes[type], displacement, count);
+
+					if (table.slots[slot] || std::find(bucket_slots.begin(), bucket_slots.end(), slot) != bucket_slots.end())
+					{
+						placed = false;
+						break;
+					}
+
+					bucket_slots.push_back(slot);
+				}
+
+				if (placed)
+					break;
+			}
+
+			table.displacements[bucket] = displacement;
+
+			for (std::size_t entry = 0; entry < bucket_slots.size(); ++entry)
+			{
+				const Index type = buckets[bucket][entry];
+				table.slots[bucket_slots[entry]] = &infos[type];
+			}
+		}
+
+		perfect_names.update([&](PerfectNameTable& published)
+		{
+			published = std::move(table);
+			return true;
+		});
+
+		return true;
+	}
+
+	const Information* GetType(const Index type)
+	{
+		Program::Assert(Valid(type), "Type index out of bounds!");
+
+		if (IsFrozenFast()) [[likely]]
+			return &Frozen().infos[type];
+
+		return &Require(infos_ptr)[type];
+	}
+
+	bool Valid(const Index type_index)
+	{
+		return type_index > kInvalidType && type_index < type_counter.load(std::memory_order_acquire);
+	}
+
+	bool AddCaster(const Information& info_a, const Information& info_b, const Caster caster_ab)
+	{
+		const ProfileScope profile(info_a.index, kProfile_Conversions);
+
+		Program::Assert(Valid(info_a.index) && Valid(info_b.index) && caster_ab, "Invalid parameters!");
+
+		const std::lock_guard lock(RegistrationMutex());
+
+		Require(casters_ptr)[info_a.index].update([&](OS::Vector<Caster>& casters)
+		{
+			if (casters.size() < std::size_t(info_b.index) + 1)
+				casters.resize(info_b.index + 1, nullptr);
+
+			casters[info_b.index] = caster_ab;
+			return true;
+		});
+
+		registry_generation.fetch_add(1, std::memory_order_release);
+		return true;
+	}
+
+	static Caster DirectCaster(const Index from, const Index to)
+	{
+		const auto& casters = Require(casters_ptr)[from].read();
+		return std::size_t(to) < casters.size() ? casters[to] : nullptr;
+	}
+
+	// Breadth first over the direct casters, so the path found is one of the shortest
+	static OS::Vector<Caster> SearchCastPath(const Index from, const Index to)
+	{
+		const Index count = type_counter.load(std::memory_order_acquire);
+
+		OS::Vector<Index> parents(count, kInvalidType);
+		OS::Vector<Index> queue = { from };
+
+		parents[from] = from;
+
+		for (std::size_t head = 0; head < queue.size() && parents[to] == kInvalidType; ++head)
+		{
+			const Index type = queue[head];
+			const auto& casters = Require(casters_ptr)[type].read();
+
+			for (Index next = 0; next < count && std::size_t(next) < casters.size(); ++next)
+			{
+				if (casters[next] && parents[next] == kInvalidType)
+				{
+					parents[next] = type;
+					queue.push_back(next);
+				}
+			}
+		}
+
+		OS::Vector<Caster> path;
+
+		if (from == to || parents[to] == kInvalidType)
+			return path;
+
+		for (Index type = to; type != from; type = parents[type])
+			path.push_back(DirectCaster(parents[type], type));
+
+		std::reverse(path.begin(), path.end());
+		return path;
+	}
+
+	// Calls use with the cached path from one type to another, searching for it first if this is its first request
+	template<typename Use>
+	static auto WithCastPath(const Index from, const Index to, Use&& use)
+	{
+		const u64 key = (u64(u32(from)) << 32) | u64(u32(to));
+
+		return ThreadCastPathMemo().with(key, [&] { return SearchCastPath(from, to); }, use);
+	}
+
+	bool IsCastableTo(const Information& info_a, const Information& info_b)
+	{
+		if (!(Valid(info_a.index) && Valid(info_b.index)))
+			return false;
+
+		if (DirectCaster(info_a.index, info_b.index))
+			return true;
+
+		return WithCastPath(info_a.index, info_b.index, [](const OS::Vector<Caster>& path) { return !path.empty(); });
+	}
+
+	Caster GetCaster(const Information& info_a, const Information& info_b)
+	{
+		Program::Assert(Valid(info_a.index) && Valid(info_b.index), "Cannot cast from A to B!");
+
+		const Caster caster = DirectCaster(info_a.index, info_b.index);
+
+		Program::Assert(caster, "Cannot cast from A to B!");
+		return caster;
+	}
+
+	View CastTo(const View view, const Information& info_b)
+	{
+		return view.cast_to(info_b);
+	}
+
+	std::size_t CastPathLength(const Information& info_a, const Information& info_b)
+	{
+		if (!(Valid(info_a.index) && Valid(info_b.index)))
+			return 0;
+
+		if (DirectCaster(info_a.index, info_b.index))
+			return 1;
+
+		return WithCastPath(info_a.index, info_b.index, [](const OS::Vector<Caster>& path) { return path.size(); });
+	}
+
+	bool AddConverter(const Information& info_a, const Information& info_b, const Converter converter_ab)
+	{
+		return AddConverter(info_a, info_b, converter_ab, nullptr);
+	}
+
+	bool AddConverter(const Information& info_a, const Information& info_b, const Converter converter_ab, const InPlaceConverter in_place_ab)
+	{
+		const ProfileScope profile(info_a.index, kProfile_Conversions);
+
+		const std::lock_guard lock(RegistrationMutex());
+
+		Require(converters_ptr)[info_a.index].update([&](OS::Vector<Converter>& converters)
+		{
+			if (converters.size() < std::size_t(info_b.index) + 1)
+				converters.resize(info_b.index + 1, nullptr);
+
+			converters[info_b.index] = converter_ab;
+			return true;
+		});
+
+		// Also when null, so a plan never pairs a new converter with the in-place form of the one it replaced
+		Require(in_place_converters_ptr)[info_a.index].update([&](OS::Vector<InPlaceConverter>& converters)
+		{
+			if (converters.size() < std::size_t(info_b.index) + 1)
+				converters.resize(info_b.index + 1, nullptr);
+
+			converters[info_b.index] = in_place_ab;
+			return true;
+		});
+
+		registry_generation.fetch_add(1, std::memory_order_release);
+		return true;
+	}
+
+	static Converter DirectConverter(const Index from, const Index to)
+	{
+		const auto& converters = Require(converters_ptr)[from].read();
+		return std::size_t(to) < converters.size() ? converters[to] : nullptr;
+	}
+
+	// Alignment of the scratch buffer intermediate values are built in
+	static constexpr std::size_t kConversionAlignment = 64;
+
+	// Every step is worth more than any number of Handles saved, so fewer steps always win
+	static constexpr u64 kConversionStepCost = u64(1) << 32;
+
+	class ConversionPlanner
+	{
+	public:
+		// Lays out the chain ending at to in the scratch buffer, each intermediate value after the last
+		static ConversionPlan Build(const Index from, const Index to, const OS::Vector<Index>& parents)
+		{
+			ConversionPlan plan;
+
+			if (from == to || parents[to] == kInvalidType)
+				return plan;
+
+			OS::Vector<Index> chain = { to };
+
+			while (chain.back() != from)
+				chain.push_back(parents[chain.back()]);
+
+			std::reverse(chain.begin(), chain.end());
+
+			std::size_t scratch_size = 0;
+
+			for (std::size_t hop = 1; hop < chain.size(); ++hop)
+			{
+				const Information& info = Require(infos_ptr)[chain[hop]];
+				ConversionPlan::Step step = { .converter = DirectConverter(chain[hop - 1], chain[hop]), .info = &info };
+
+				const auto& in_place = Require(in_place_converters_ptr)[chain[hop - 1]].read();
+				const std::size_t offset = (scratch_size + info.alignment - 1) / info.alignment * info.alignment;
+
+				// The result is the only value that must outlive the plan, so it alone always takes a Handle
+				if (hop + 1 < chain.size() && std::size_t(chain[hop]) < in_place.size() && in_place[chain[hop]]
+					&& info.alignment <= kConversionAlignment && offset + info.size <= kConversionScratchBytes)
+				{
+					step.destructor = Require(destructors_ptr)[chain[hop]].load(std::memory_order_acquire);
+
+					if (step.destructor)
+					{
+						step.in_place = in_place[chain[hop]];
+						step.offset = offset;
+						scratch_size = offset + info.size;
+					}
+				}
+
+				plan.steps.push_back(step);
+			}
+
+			return plan;
+		}
+	};
+
+	// Calls use with the memoized plan from one type to another, searching for it first if this is its first request
+	template<typename Use>
+	static auto WithConversionPlan(const Index from, const Index to, Use&& use);
+
+	// Dijkstra over the direct converters
+	static ConversionPlan SearchConversionPlan(const Index from, const Index to)
+	{
+		const Index count = type_counter.load(std::memory_order_acquire);
+
+		OS::Vector<u64> costs(count, std::numeric_limits<u64>::max());
+		OS::Vector<Index> parents(count, kInvalidType);
+		std::priority_queue<std::pair<u64, Index>, OS::Vector<std::pair<u64, Index>>, std::greater<>> frontier;
+
+		costs[from] = 0;
+		frontier.emplace(0, from);
+
+		while (!frontier.empty())
+		{
+			const auto [cost, type] = frontier.top();
+			frontier.pop();
+
+			if (type == to)
+				break;
+
+			if (cost > costs[type])
+				continue;
+
+			const auto& converters = Require(converters_ptr)[type].read();
+			const auto& in_place = Require(in_place_converters_ptr)[type].read();
+
+			for (Index next = 0; next < count && std::size_t(next) < converters.size(); ++next)
+			{
+				if (!converters[next])
+					continue;
+
+				// Build() always gives the result a Handle, so an in-place converter only saves one before the last hop
+				const bool needs_handle = next == to || std::size_t(next) >= in_place.size() || !in_place[next];
+				const u64 next_cost = cost + kConversionStepCost + (needs_handle ? 1 : 0);
+
+				if (next_cost < costs[next])
+				{
+					costs[next] = next_cost;
+					parents[next] = type;
+					frontier.emplace(next_cost, next);
+				}
+			}
+		}
+
+		return ConversionPlanner::Build(from, to, parents);
+	}
+
+	template<typename Use>
+	static auto WithConversionPlan(const Index from, const Index to, Use&& use)
+	{
+		const u64 key = (u64(u32(from)) << 32) | u64(u32(to));
+
+		return ThreadConversionPlanMemo().with(key, [&] { return SearchConversionPlan(from, to); }, use);
+	}
+
+	bool IsConvertibleTo(const Information& info_a, const Information& info_b)
+	{
+		if (!(Valid(info_a.index) && Valid(info_b.index)))
+			return false;
+
+		if (DirectConverter(info_a.index, info_b.index))
+			return true;
+
+		return WithConversionPlan(info_a.index, info_b.index, [](const ConversionPlan& plan) { return plan.valid(); });
+	}
+
+	Converter GetConverter(const Information& info_a, const Information& info_b)
+	{
+		Program::Assert(Valid(info_a.index) && Valid(info_b.index), "Cannot convert from A to B!");
+
+		const Converter converter = DirectConverter(info_a.index, info_b.index);
+
+		Program::Assert(converter, "Cannot convert from A to B!");
+		return converter;
+	}
+
+	Handle ConvertTo(const View view, const Information& info_b)
+	{
+		return Handle(view).convert_to(info_b);
+	}
+
+	ConversionPlan PlanConversion(const Information& info_a, const Information& info_b)
+	{
+		if (!(Valid(info_a.index) && Valid(info_b.index)))
+			return {};
+
+		return WithConversionPlan(info_a.index, info_b.index, [](const ConversionPlan& plan) { return plan; });
+	}
+
+	Handle ConversionPlan::execute(const View source) const
+	{
+		Program::Assert(valid(), "No conversion plan!");
+
+		alignas(kConversionAlignment) std::byte scratch[kConversionScratchBytes];
+
+		View current = source;
+		Handle carried;
+		const Step* built = nullptr; // The step whose value current views in the scratch buffer
+
+		for (const Step& step : steps)
+		{
+			if (step.in_place)
+			{
+				const View next(scratch + step.offset, *step.info, kQualifier_Reference);
+				step.in_place(next, current);
+
+				if (built)
+					built->destructor(current);
+
+				carried = Handle();
+				current = next;
+				built = &step;
+			}
+			else
+			{
+				Handle next = step.converter(current);
+
+				if (built)
+					built->destructor(current);
+
+				carried = std::move(next);
+				current = carried.peek();
+				built = nullptr;
+			}
+		}
+
+		// The last step always returns a Handle
+		return carried;
+	}
+
+	bool AddInheritance(Information& derived_info, const OS::Vector<Index>& directly_inherited)
+	{
+		const ProfileScope profile(derived_info.index, kProfile_Inheritance);
+
+		const std::lock_guard lock(RegistrationMutex());
+
+		RequireMutable();
+
+		if (directly_inherited.empty())
+			return true;
+
+		if (std::size_t(derived_info.index) < snapshot_bases.size() && snapshot_bases[derived_info.index])
+			return true;
+
+		for (const Index parent : directly_inherited)
+		{
+			if (!Valid(parent))
+				return false;
+		}
+
+		if (direct_bases.size() <= std::size_t(derived_info.index))
+			direct_bases.resize(derived_info.index + 1);
+
+		OS::Vector<Index>& bases = direct_bases[derived_info.index];
+
+		for (const Index parent : directly_inherited)
+		{
+			if (parent != derived_info.index && std::find(bases.begin(), bases.end(), parent) == bases.end())
+				bases.push_back(parent);
+		}
+
+		hierarchy_stale.store(true, std::memory_order_release);
+		registry_generation.fetch_add(1, std::memory_order_release);
+		return true;
+	}
+
+	bool AddConstructor(const Information& info, const Constructor constructor, const FunctionSignature signature)
+	{
+		const ProfileScope profile(info.index, kProfile_Constructors);
+
+		const std::lock_guard lock(RegistrationMutex());
+
+		RequireMutable();
+
+		const SignatureId id = InternSignature(signature);
+		const bool added = Require(constructors_ptr)[info.index].update([&](ConstructorMap& constructors)
+		{
+			return InsertBySignature(constructors, id, constructor);
+		});
+
+		if (added)
+		{
+			ContextTablesChanged(info.index);
+			registry_generation.fetch_add(1, std::memory_order_release);
+		}
+
+		return added;
+	}
+
+	Constructor GetConstructor(const Information& info, const FunctionSignature signature)
+	{
+		return GetConstructor(info, FindSignature(signature));
+	}
+
+	Constructor GetConstructor(const Information& info, const SignatureId signature)
+	{
+		CountDispatch({ .type = info.index, .detail = signature, .operation = kDispatch_GetConstructor });
+
+		const Constructor constructor = FindConstructor(info, signature);
+
+		Program::Assert(constructor, "No constructor with the specified signature!");
+		return constructor;
+	}
+
+	bool AddDestructor(const Information& info, const Destructor destructor)
+	{
+		const ProfileScope profile(info.index, kProfile_Destructors);
+
+		const std::lock_guard lock(RegistrationMutex());
+
+		RequireMutable();
+
+		Require(destructors_ptr)[info.index].store(destructor, std::memory_order_release);
+		ContextTablesChanged(info.index);
+		registry_generation.fetch_add(1, std::memory_order_release);
+		return true;
+	}
+
+	Destructor GetDestructor(const Information& info)
+	{
+		CountDispatch({ .type = info.index, .operation = kDispatch_GetDestructor });
+
+		if (IsFrozenFast()) [[likely]]
+		{
+			const Destructor destructor = Frozen().destructors[info.index];
+
+			Program::Assert(destructor, "No destructor specified!");
+			return destructor;
+		}
+
+		const Destructor destructor = Require(destructors_ptr)[info.index].load(std::memory_order_acquire);
+
+		Program::Assert(destructor, "No destructor specified!");
+		return destructor;
+	}
+
+	bool AddAssigner(const Information& info, const Assigner assigner, const FunctionSignature signature)
+	{
+		const ProfileScope profile(info.index, kProfile_Assigners);
+
+		const std::lock_guard lock(RegistrationMutex());
+
+		RequireMutable();
+
+		const SignatureId id = InternSignature(signature);
+		const bool added = Require(assigners_ptr)[info.index].update([&](AssignersMap& assigners)
+		{
+			return InsertBySignature(assigners, id, assigner);
+		});
+
+		if (added)
+		{
+			ContextTablesChanged(info.index);
+			registry_generation.fetch_add(1, std::memory_order_release);
+		}
+
+		return added;
+	}
+
+	Assigner GetAssigner(const Information& info, const FunctionSignature signature)
+	{
+		return GetAssigner(info, FindSignature(signature));
+	}
+
+	Assigner GetAssigner(const Information& info, const SignatureId signature)
+	{
+		CountDispatch({ .type = info.index, .detail = signature, .operation = kDispatch_GetAssigner });
+
+		if (IsFrozenFast()) [[likely]]
+		{
+			const Assigner assigner = FindFrozen(Frozen().assigner_offsets, Frozen().assigners, info.index, signature);
+
+			Program::Assert(assigner, "No assigner with the specified signature!");
+			return assigner;
+		}
+
+		Populate(info.index);
+
+		const Assigner assigner = FindBySignature(Require(assigners_ptr)[info.index].read(), signature);
+
+		Program::Assert(assigner, "No assigner with the specified signature!");
+		return assigner;
+	}
+
+	static const MethodSet* FindMethodSet(const MethodsMap& sets, const wchar_t* name)
+	{
+		const auto iterator = std::lower_bound(sets.begin(), sets.end(), name, [](const MethodSet& set, const wchar_t* key) { return set.name.data() < key; });
+		return iterator != sets.end() && iterator->name.data() == name ? &*iterator : nullptr;
+	}
+
+	bool AddMethod(const Information& info, const Program::Name name, const Method method, const FunctionSignature signature)
+	{
+		return AddMethod(info, name, method, nullptr, signature);
+	}
+
+	bool AddMethod(const Information& info, const Program::Name name, const Method method, const MethodInto method_into, const FunctionSignature signature)
+	{
+		const ProfileScope profile(info.index, kProfile_Methods);
+
+		Program::Assert(Valid(info.index) && !name.empty() && method, "Invalid parameters!");
+
+		const std::lock_guard lock(RegistrationMutex());
+
+		RequireMutable();
+
+		const SignatureId id = InternSignature(signature);
+		const bool added = Require(methods_ptr)[info.index].update([&](MethodsMap& sets)
+		{
+			auto iterator = std::lower_bound(sets.begin(), sets.end(), name.data(), [](const MethodSet& set, const wchar_t* key) { return set.name.data() < key; });
+
+			if (iterator == sets.end() || iterator->name.data() != name.data())
+				iterator = sets.insert(iterator, MethodSet{ .name = name });
+
+			if (!InsertBySignature(iterator->overloads, id, method))
+				return false;
+
+			if (method_into)
+				InsertBySignature(iterator->into, id, method_into);
+
+			return true;
+		});
+
+		if (added)
+			registry_generation.fetch_add(1, std::memory_order_release);
+
+		return added;
+	}
+
+	static MethodsMap MergeVisibleMethods(const Index type)
+	{
+		const std::lock_guard lock(RegistrationMutex());
+
+		MethodsMap sets = Require(methods_ptr)[type].read();
+
+		if (std::size_t(type) < direct_bases.size())
+		{
+			for (const Index base : direct_bases[type])
+			{
+				const std::size_t visible_before = sets.size();
+
+				// Bases are merged from their own memoized sets
+				ThreadVisibleMethodsMemo().with(base, [&] { return MergeVisibleMethods(base); }, [&](const MethodsMap& inherited_sets)
+				{
+					for (const MethodSet& inherited : inherited_sets)
+					{
+						const auto hides = [&](const MethodSet& set) { return set.name.data() == inherited.name.data(); };
+
+						if (std::none_of(sets.begin(), std::next(sets.begin(), std::ptrdiff_t(visible_before)), hides))
+							sets.push_back(inherited);
+					}
+				});
+
+				std::sort(sets.begin(), sets.end(), [](const MethodSet& a, const MethodSet& b) { return a.name.data() < b.name.data(); });
+			}
+		}
+
+		return sets;
+	}
+
+	// Calls use with the type's visible method sets, merging them first if this thread has none for this generation
+	template<typename Use>
+	static auto WithVisibleMethods(const Index type, Use&& use)
+	{
+		return ThreadVisibleMethodsMemo().with(type, [&] { return MergeVisibleMethods(type); }, use);
+	}
+
+	bool HasMethod(const Information& info, const Program::Name name)
+	{
+		return Valid(info.index) && WithVisibleMethods(info.index, [&](const MethodsMap& sets) { return FindMethodSet(sets, name.data()) != nullptr; });
+	}
+
+	Method GetMethod(const Information& info, const Program::Name name, const FunctionSignature signature)
+	{
+		return GetMethod(info, name, FindSignature(signature));
+	}
+
+	Method GetMethod(const Information& info, const Program::Name name, const SignatureId signature)
+	{
+		const Method method = WithVisibleMethods(info.index, [&](const MethodsMap& sets)
+		{
+			const MethodSet* methods = FindMethodSet(sets, name.data());
+			return methods ? FindBySignature(methods->overloads, signature) : nullptr;
+		});
+
+		Program::Assert(method, "No method with the specified name and signature!");
+		return method;
+	}
+
+	MethodInto GetMethodInto(const Information& info, const Program::Name name, const SignatureId signature)
+	{
+		const MethodInto method_into = WithVisibleMethods(info.index, [&](const MethodsMap& sets)
+		{
+			const MethodSet* methods = FindMethodSet(sets, name.data());
+			return methods ? FindBySignature(methods->into, signature) : nullptr;
+		});
+
+		Program::Assert(method_into, "No Into form of a method with the specified name and signature!");
+		return method_into;
+	}
+
+	bool AddField(const Information& info, const Field& field)
+	{
+		const ProfileScope profile(info.index, kProfile_Fields);
+
+		Program::Assert(Valid(info.index) && field.owner == info.index && !field.name.empty() && Valid(field.type), "Invalid parameters!");
+		Program::Assert(field.offset + SizeOf(field.type) <= info.size, "Field lies outside of its owner!");
+
+		const std::lock_guard lock(RegistrationMutex());
+
+		RequireMutable();
+
+		return Require(fields_ptr)[info.index].update([&](FieldsMap& fields)
+		{
+			const auto iterator = std::lower_bound(fields.begin(), fields.end(), field.name.data(), [](const Field& entry, const wchar_t* key) { return entry.name.data() < key; });
+
+			if (iterator != fields.end() && iterator->name.data() == field.name.data())
+				return false;
+
+			fields.insert(iterator, field);
+			return true;
+		});
+	}
+
+	const Field* FindField(const Information& info, const Program::Name name)
+	{
+		if (!Valid(info.index))
+			return nullptr;
+
+		const FieldsMap& fields = Require(fields_ptr)[info.index].read();
+		const auto iterator = std::lower_bound(fields.begin(), fields.end(), name.data(), [](const Field& entry, const wchar_t* key) { return entry.name.data() < key; });
+
+		return iterator != fields.end() && iterator->name.data() == name.data() ? &*iterator : nullptr;
+	}
+
+	const Field& GetField(const Information& info, const Program::Name name)
+	{
+		const Field* field = FindField(info, name);
+
+		Program::Assert(field, "No field with the specified name!");
+		return *field;
+	}
+
+	std::span<const Field> GetFields(const Information& info)
+	{
+		Program::Assert(Valid(info.index), "Invalid parameters!");
+
+		const FieldsMap& fields = Require(fields_ptr)[info.index].read();
+		return { fields.data(), fields.size() };
+	}
+
+	View FieldOf(const View object, const Field& field)
+	{
+		Program::Assert(object.valid() && !object.is_in_place_primitive(), "Fields can only be reached through objects in memory!");
+
+		// Bases are reached through the same address, as View::as() does
+		Program::Assert(object.type == field.owner || InheritsFrom(object.type, field.owner), "The object has no such field!");
+
+		const auto qualifiers = Qualifier(kQualifier_Reference | field.qualifiers | (object.qualifiers & (kQualifier_Constant | kQualifier_Volatile)));
+
+		return { static_cast<u8*>(object.internal()) + field.offset, *GetType(field.type), qualifiers };
+	}
+
+	// Fixed sizes let the copy compile down to plain loads and stores
+	template<std::size_t Size>
+	static void CopyStrided(u8* target, const std::size_t target_stride, const u8* source, const std::size_t source_stride, const std::size_t count)
+	{
+		for (std::size_t index = 0; index < count; ++index)
+			std::memcpy(target + (index * target_stride), source + (index * source_stride), Size);
+	}
+
+	static void CopyStrided(const Field& field, u8* target, const std::size_t target_stride, const u8* source, const std::size_t source_stride, const std::size_t count)
+	{
+		const std::size_t size = SizeOf(field.type);
+
+		if (field.copier)
+		{
+			for (std::size_t index = 0; index < count; ++index)
+				field.copier(target + (index * target_stride), source + (index * source_stride));
+
+			return;
+		}
+
+		switch (size)
+		{
+			case 1:  CopyStrided<1>(target, target_stride, source, source_stride, count); break;
+			case 2:  CopyStrided<2>(target, target_stride, source, source_stride, count); break;
+			case 4:  CopyStrided<4>(target, target_stride, source, source_stride, count); break;
+			case 8:  CopyStrided<8>(target, target_stride, source, source_stride, count); break;
+			case 16: CopyStrided<16>(target, target_stride, source, source_stride, count); break;
+			default:
+				for (std::size_t index = 0; index < count; ++index)
+					std::memcpy(target + (index * target_stride), source + (index * source_stride), size);
+		}
+	}
+
+	void ReadField(const Field& field, const void* objects, void* values, const std::size_t count)
+	{
+		Program::Assert(Valid(field.owner) && Valid(field.type) && ((objects && values) || count == 0), "Invalid parameters!");
+
+		CopyStrided(field, static_cast<u8*>(values), SizeOf(field.type), static_cast<const u8*>(objects) + field.offset, SizeOf(field.owner), count);
+	}
+
+	void WriteField(const Field& field, void* objects, const void* values, const std::size_t count)
+	{
+		Program::Assert(Valid(field.owner) && Valid(field.type) && ((objects && values) || count == 0), "Invalid parameters!");
+		Program::Assert(!(field.qualifiers & kQualifier_Constant), "Cannot write to a const field!");
+
+		CopyStrided(field, static_cast<u8*>(objects) + field.offset, SizeOf(field.owner), static_cast<const u8*>(values), SizeOf(field.type), count);
+	}
+
+	void CopyField(const Field& field, const void* source, void* target, const std::size_t count)
+	{
+		Program::Assert(Valid(field.owner) && Valid(field.type) && ((source && target) || count == 0), "Invalid parameters!");
+		Program::Assert(!(field.qualifiers & kQualifier_Constant), "Cannot write to a const field!");
+
+		const std::size_t stride = SizeOf(field.owner);
+		CopyStrided(field, static_cast<u8*>(target) + field.offset, stride, static_cast<const u8*>(source) + field.offset, stride, count);
+	}
+
+	// Exact follows View::is(), so derived arguments bind to base parameters without converting
+	static Conversion Classify(const Parameter argument, const Parameter parameter)
+	{
+		if (argument.second == kQualifier_InPlace)
+		{
+			if (argument.first == parameter.first)
+				return kConversion_Exact;
+		}
+		else if (QualifiersBind(argument.second, parameter.second) && (argument.first == parameter.first || InheritsFrom(argument.first, parameter.first)))
+			return kConversion_Exact;
+
+		if (!(Valid(argument.first) && Valid(parameter.first)))
+			return kConversion_None;
+
+		const Information& from = *GetType(argument.first);
+		const Information& to = *GetType(parameter.first);
+
+		if (IsConvertibleTo(from, to))
+			return kConversion_Convert;
+		if (IsCastableTo(from, to))
+			return kConversion_Cast;
+
+		return kConversion_None;
+	}
+
+	template<typename Function>
+	static std::pair<Overload, Function> RankOverloads(const SignatureMap<Function>& candidates, const SignatureId arguments)
+	{
+		const OS::Vector<Parameter>& argument_types = signature_nodes[arguments].parameters;
+
+		Overload best;
+		Function best_function = nullptr;
+
+		for (const auto& [signature, function] : candidates)
+		{
+			const OS::Vector<Parameter>& parameters = signature_nodes[signature].parameters;
+
+			if (parameters.size() != argument_types.size())
+				continue;
+
+			Overload overload = { .signature = signature };
+			bool viable = true;
+
+			for (std::size_t i = 0; i < parameters.size() && viable; ++i)
+			{
+				const Conversion conversion = Classify(argument_types[i], parameters[i]);
+
+				viable = conversion != kConversion_None;
+				overload.cost += u32(conversion);
+				overload.conversions |= u64(conversion) << (i * 2);
+			}
+
+			// Candidates are sorted by signature, so a tie keeps the earlier one
+			if (viable && (!best.valid() || overload.cost < best.cost))
+			{
+				best = overload;
+				best_function = function;
+			}
+		}
+
+		return { best, best_function };
+	}
+
+	static ResolvedOverload Resolve(const OverloadKey& key)
+	{
+		return ThreadOverloadMemo().with(key, [&]
+		{
+			ResolvedOverload resolved;
+
+			if (key.set == kOverloadSet_Constructors)
+				std::tie(resolved.overload, resolved.constructor) = RankOverloads(Require(constructors_ptr)[key.type].read(), key.arguments);
+			else if (key.set == kOverloadSet_Assigners)
+			{
+				if (!IsFrozenFast())
+					Populate(key.type);
+
+				std::tie(resolved.overload, resolved.assigner) = RankOverloads(Require(assigners_ptr)[key.type].read(), key.arguments);
+			}
+			else
+			{
+				WithVisibleMethods(key.type, [&](const MethodsMap& sets)
+				{
+					if (const MethodSet* methods = FindMethodSet(sets, key.name))
+					{
+						std::tie(resolved.overload, resolved.method) = RankOverloads(methods->overloads, key.arguments);
+						resolved.method_into = FindBySignature(methods->into, resolved.overload.signature);
+					}
+				});
+			}
+
+			Program::Assert(resolved.overload.valid(), "No overload takes these arguments!");
+			return resolved;
+		},
+		[](const ResolvedOverload& resolved) { return resolved; });
+	}
+
+	static SignatureId ArgumentSignature(const Spandle& arguments)
+	{
+		Program::Assert(arguments.size() <= kMaximumOverloadArguments, "Too many arguments to resolve an overload!");
+		return arguments.get_argument_signature_id();
+	}
+
+	// Converted arguments own their values; exact and cast ones only view the caller's
+	static void ConvertArguments(const Overload& overload, const Spandle& values, Spandle& converted)
+	{
+		const OS::Vector<Parameter>& parameters = signature_nodes[overload.signature].parameters;
+
+		for (Memory::Index i = 0; i < Memory::Index(values.size()); ++i)
+		{
+			const View view = values[i].peek();
+
+			switch (overload.get_conversion(i))
+			{
+			case kConversion_Convert:
+				converted[i] = ConvertTo(view, *GetType(parameters[i].first));
+				break;
+			case kConversion_Cast:
+				converted[i] = Handle(view.cast_to(*GetType(parameters[i].first)));
+				break;
+			default:
+				converted[i] = Handle(view);
+				break;
+			}
+		}
+	}
+
+	Overload ResolveOverload(const OverloadSet set, const Information& info, const Spandle& arguments)
+	{
+		Program::Assert(set != kOverloadSet_Methods, "Methods resolve by name through ResolveMethod()!");
+		return Resolve({ .type = info.index, .arguments = ArgumentSignature(arguments), .set = set }).overload;
+	}
+
+	Overload ResolveMethod(const Information& info, const Program::Name name, const Spandle& arguments)
+	{
+		return Resolve({ .name = name.data(), .type = info.index, .arguments = ArgumentSignature(arguments), .set = kOverloadSet_Methods }).overload;
+	}
+
+	void Construct(const Information& info, const View target, const Spandle& arguments)
+	{
+		const SignatureId signature = ArgumentSignature(arguments);
+		const DispatchScope dispatch({ .type = info.index, .detail = signature, .operation = kDispatch_Construct });
+		const ResolvedOverload resolved = Resolve({ .type = info.index, .arguments = signature, .set = kOverloadSet_Constructors });
+
+		if (resolved.overload.conversions == 0)
+		{
+			resolved.constructor(target, arguments);
+			return;
+		}
+
+		Spandle converted = Spandle::reserve(arguments.size());
+		ConvertArguments(resolved.overload, arguments, converted);
+		resolved.constructor(target, converted);
+	}
+
+	View Assign(const Information& info, const View target, const Spandle& arguments)
+	{
+		const SignatureId signature = ArgumentSignature(arguments);
+		const DispatchScope dispatch({ .type = info.index, .detail = signature, .operation = kDispatch_Assign });
+		const ResolvedOverload resolved = Resolve({ .type = info.index, .arguments = signature, .set = kOverloadSet_Assigners });
+
+		if (resolved.overload.conversions == 0)
+			return resolved.assigner(target, arguments);
+
+		Spandle converted = Spandle::reserve(arguments.size());
+		ConvertArguments(resolved.overload, arguments, converted);
+		return resolved.assigner(target, converted);
+	}
+
+	Handle Invoke(const Information& info, const Program::Name name, const View object, const Spandle& arguments)
+	{
+		const SignatureId signature = ArgumentSignature(arguments);
+		const DispatchScope dispatch({ .type = info.index, .name = name, .detail = signature, .operation = kDispatch_Invoke });
+		const ResolvedOverload resolved = Resolve({ .name = name.data(), .type = info.index, .arguments = signature, .set = kOverloadSet_Methods });
+
+		if (resolved.overload.conversions == 0)
+			return resolved.method(object, arguments);
+
+		Spandle converted = Spandle::reserve(arguments.size());
+		ConvertArguments(resolved.overload, arguments, converted);
+		return resolved.method(object, converted);
+	}
+
+	// For functions registered without an Into form, at the cost of the Handle they return
+	static void AssignResult(const Index destination_type, const View destination, const Handle& result)
+	{
+		Program::Assert(Valid(destination_type), "Not a valid destination!");
+		Assign(Require(infos_ptr)[destination_type], destination, ArgPack(result.peek()));
+	}
+
+	void InvokeInto(const Information& info, const Program::Name name, const View destination, const View object, const Spandle& arguments)
+	{
+		const SignatureId signature = ArgumentSignature(arguments);
+		const DispatchScope dispatch({ .type = info.index, .name = name, .detail = signature, .operation = kDispatch_Invoke });
+		const ResolvedOverload resolved = Resolve({ .name = name.data(), .type = info.index, .arguments = signature, .set = kOverloadSet_Methods });
+
+		if (resolved.overload.conversions == 0)
+		{
+			if (resolved.method_into) [[likely]]
+				resolved.method_into(destination, object, arguments);
+			else
+				AssignResult(destination.get_type(), destination, resolved.method(object, arguments));
+
+			return;
+		}
+
+		Spandle converted = Spandle::reserve(arguments.size());
+		ConvertArguments(resolved.overload, arguments, converted);
+
+		if (resolved.method_into)
+			resolved.method_into(destination, object, converted);
+		else
+			AssignResult(destination.get_type(), destination, resolved.method(object, converted));
+	}
+
+	bool AddUnaryOp(const Information& info, const UnaryOperator unary_operator, const UnaryOperation type, const FunctionSignature signature)
+	{
+		return AddUnaryOp(info, unary_operator, nullptr, kInvalidType, type, signature);
+	}
+
+	bool AddUnaryOp(const Information& info, const UnaryOperator unary_operator, const UnaryOperatorInto unary_operator_into, const Index result, const UnaryOperation type, const FunctionSignature signature)
+	{
+		const ProfileScope profile(info.index, kProfile_Operators);
+
+		const std::lock_guard lock(RegistrationMutex());
+
+		const SignatureId id = InternSignature(signature);
+		const bool added = Require(unary_ops_ptr)[info.index][std::size_t(type)].update([&](auto& unary_ops)
+		{
+			return InsertBySignature(unary_ops, id, unary_operator);
+		});
+
+		if (added && unary_operator_into)
+		{
+			Require(unary_ops_into_ptr)[info.index][std::size_t(type)].update([&](auto& unary_ops_into)
+			{
+				return InsertBySignature(unary_ops_into, id, OperatorInto<UnaryOperatorInto>{ unary_operator_into, result });
+			});
+		}
+
+		if (added)
+		{
+			Require(operator_rows_ptr)[info.index].built.store(false, std::memory_order_release);
+			registry_generation.fetch_add(1, std::memory_order_release);
+		}
+
+		return added;
+	}
+
+	bool AddBinaryOp(const Information& info, const BinaryOperator binary_operator, const BinaryOperation type, const FunctionSignature signature)
+	{
+		return AddBinaryOp(info, binary_operator, nullptr, kInvalidType, type, signature);
+	}
+
+	bool AddBinaryOp(const Information& info, const BinaryOperator binary_operator, const BinaryOperatorInto binary_operator_into, const Index result, const BinaryOperation type, const FunctionSignature signature)
+	{
+		const ProfileScope profile(info.index, kProfile_Operators);
+
+		const std::lock_guard lock(RegistrationMutex());
+
+		const SignatureId id = InternSignature(signature);
+		const bool added = Require(binary_ops_ptr)[info.index][std::size_t(type)].update([&](auto& binary_ops)
+		{
+			return InsertBySignature(binary_ops, id, binary_operator);
+		});
+
+		if (added && binary_operator_into)
+		{
+			Require(binary_ops_into_ptr)[info.index][std::size_t(type)].update([&](auto& binary_ops_into)
+			{
+				return InsertBySignature(binary_ops_into, id, OperatorInto<BinaryOperatorInto>{ binary_operator_into, result });
+			});
+		}
+
+		if (added)
+		{
+			Require(operator_rows_ptr)[info.index].built.store(false, std::memory_order_release);
+			registry_generation.fetch_add(1, std::memory_order_release);
+		}
+
+		return added;
+	}
+
+	UnaryOperator GetUnaryOp(const Information& info, const UnaryOperation type, const FunctionSignature signature)
+	{
+		return GetUnaryOp(info, type, FindSignature(signature));
+	}
+
+	UnaryOperator GetUnaryOp(const Information& info, const UnaryOperation type, const SignatureId signature)
+	{
+		Program::Assert(Valid(info.index) && type < kUnaryOperation_Count, "Invalid parameters!");
+
+		Populate(info.index);
+
+		const UnaryOperator unary_operator = FindBySignature(Require(unary_ops_ptr)[info.index][std::size_t(type)].read(), signature);
+
+		Program::Assert(unary_operator, "No unary operator with the specified signature!");
+		return unary_operator;
+	}
+
+	BinaryOperator GetBinaryOp(const Information& info, const BinaryOperation type, const FunctionSignature signature)
+	{
+		return GetBinaryOp(info, type, FindSignature(signature));
+	}
+
+	BinaryOperator GetBinaryOp(const Information& info, const BinaryOperation type, const SignatureId signature)
+	{
+		Program::Assert(Valid(info.index) && type < kBinaryOperation_Count, "Invalid parameters!");
+
+		Populate(info.index);
+
+		const BinaryOperator binary_operator = FindBySignature(Require(binary_ops_ptr)[info.index][std::size_t(type)].read(), signature);
+
+		Program::Assert(binary_operator, "No binary operator with the specified signature!");
+		return binary_operator;
+	}
+
+	static OperatorRow BuildOperatorRow(const Index type)
+	{
+		OperatorRow row;
+
+		const auto& unary_ops = Require(unary_ops_ptr)[type];
+		const auto& unary_ops_into = Require(unary_ops_into_ptr)[type];
+
+		for (std::size_t operation = 0; operation < kUnaryOperation_Count; ++operation)
+		{
+			const auto& operators = unary_ops[operation].read();
+
+			if (operators.empty())
+				continue;
+
+			// Lowest signature ID wins when one type has the operator under several qualifiers
+			const auto& [signature, unary_operator] = operators.front();
+
+			row.unary.operators[operation] = unary_operator;
+			row.unary.into[operation] = FindBySignature(unary_ops_into[operation].read(), signature);
+		}
+
+		const auto& binary_ops = Require(binary_ops_ptr)[type];
+		const auto& binary_ops_into = Require(binary_ops_into_ptr)[type];
+
+		for (std::size_t operation = 0; operation < kBinaryOperation_Count; ++operation)
+		{
+			for (const auto& [signature, binary_operator] : binary_ops[operation].read())
+			{
+				const auto& parameters = signature_nodes[signature].parameters;
+
+				if (parameters.size() != 2)
+					continue;
+
+				const Index rhs = parameters[1].first;
+				BinarySlots* slots = &row.same_type;
+
+				if (rhs != type)
+				{
+					auto iterator = std::lower_bound(row.mixed_type.begin(), row.mixed_type.end(), rhs, [](const auto& entry, const Index key) { return entry.first < key; });
+
+					if (iterator == row.mixed_type.end() || iterator->first != rhs)
+						iterator = row.mixed_type.insert(iterator, { rhs, BinarySlots() });
+
+					slots = &iterator->second;
+				}
+
+				if (!slots->operators[operation])
+				{
+					slots->operators[operation] = binary_operator;
+					slots->into[operation] = FindBySignature(binary_ops_into[operation].read(), signature);
+				}
+			}
+		}
+
+		return row;
+	}
+
+	// Only the type itself is populated, so the first dispatch on one type leaves every other one lazy
+	static const OperatorRow& OperatorRowOf(const Index type)
+	{
+		static const OperatorRow empty;
+
+		if (u32(type) >= u32(type_counter.load(std::memory_order_acquire))) [[unlikely]]
+			return empty;
+
+		OperatorRowSlot& slot = Require(operator_rows_ptr)[type];
+
+		if (!slot.built.load(std::memory_order_acquire)) [[unlikely]]
+		{
+			const std::lock_guard lock(RegistrationMutex());
+
+			Populate(type);
+
+			if (!slot.built.load(std::memory_order_relaxed))
+			{
+				slot.row.update([&](OperatorRow& row) { row = BuildOperatorRow(type); });
+				slot.built.store(true, std::memory_order_release);
+			}
+		}
+
+		return slot.row.read();
+	}
+
+	// Slots of the operators on the operand types, or null for an invalid operation so every lookup misses
+	static const UnarySlots* UnarySlotsOf(const UnaryOperation operation, const Index operand)
+	{
+		return operation < kUnaryOperation_Count ? &OperatorRowOf(operand).unary : nullptr;
+	}
+
+	static const BinarySlots* BinarySlotsOf(const BinaryOperation operation, const Index lhs, const Index rhs)
+	{
+		if (operation >= kBinaryOperation_Count)
+			return nullptr;
+
+		if (lhs == rhs) [[likely]]
+			return &OperatorRowOf(lhs).same_type;
+
+		// The right operand's populators may add operators to the left one, which drops its row before it is read
+		if (u32(rhs) < u32(type_counter.load(std::memory_order_acquire)))
+			Populate(rhs);
+
+		const auto& mixed_type = OperatorRowOf(lhs).mixed_type;
+		const auto iterator = std::lower_bound(mixed_type.begin(), mixed_type.end(), rhs, [](const auto& entry, const Index key) { return entry.first < key; });
+
+		return iterator != mixed_type.end() && iterator->first == rhs ? &iterator->second : nullptr;
+	}
+
+	static UnaryOperator FindUnaryOperator(const UnaryOperation operation, const Index operand)
+	{
+		const UnarySlots* slots = UnarySlotsOf(operation, operand);
+		return slots ? slots->operators[operation] : nullptr;
+	}
+
+	static BinaryOperator FindBinaryOperator(const BinaryOperation operation, const Index lhs, const Index rhs)
+	{
+		const BinarySlots* slots = BinarySlotsOf(operation, lhs, rhs);
+		return slots ? slots->operators[operation] : nullptr;
+	}
+
+	Handle Apply(const UnaryOperation operation, const View operand)
+	{
+		const Index type = operand.get_type();
+		const DispatchScope dispatch({ .type = type, .detail = operation, .operation = kDispatch_UnaryOperator });
+		const UnaryOperator unary_operator = FindUnaryOperator(operation, type);
+
+		Program::Assert(unary_operator, "No unary operator for the operand's type!");
+		return unary_operator(operand);
+	}
+
+	Handle Apply(const BinaryOperation operation, const View lhs, const View rhs)
+	{
+		const Index lhs_type = lhs.get_type();
+		const Index rhs_type = rhs.get_type();
+		const DispatchScope dispatch({ .type = lhs_type, .other = rhs_type, .detail = operation, .operation = kDispatch_BinaryOperator });
+		const BinaryOperator binary_operator = FindBinaryOperator(operation, lhs_type, rhs_type);
+
+		Program::Assert(binary_operator, "No binary operator for the operands' types!");
+		return binary_operator(lhs, rhs);
+	}
+
+	void ApplyInto(const UnaryOperation operation, const View destination, const View operand)
+	{
+		const Index type = operand.get_type();
+		const DispatchScope profile({ .type = type, .detail = operation, .operation = kDispatch_UnaryOperator });
+		const UnarySlots* slots = UnarySlotsOf(operation, type);
+
+		if (const UnaryOperatorInto unary_operator_into = slots ? slots->into[operation].function : nullptr) [[likely]]
+		{
+			unary_operator_into(destination, operand);
+			return;
+		}
+
+		Program::Assert(slots && slots->operators[operation], "No unary operator for the operand's type!");
+		AssignResult(destination.get_type(), destination, slots->operators[operation](operand));
+	}
+
+	void ApplyInto(const BinaryOperation operation, const View destination, const View lhs, const View rhs)
+	{
+		const Index lhs_type = lhs.get_type();
+		const Index rhs_type = rhs.get_type();
+		const DispatchScope profile({ .type = lhs_type, .other = rhs_type, .detail = operation, .operation = kDispatch_BinaryOperator });
+		const BinarySlots* slots = BinarySlotsOf(operation, lhs_type, rhs_type);
+
+		if (const BinaryOperatorInto binary_operator_into = slots ? slots->into[operation].function : nullptr) [[likely]]
+		{
+			binary_operator_into(destination, lhs, rhs);
+			return;
+		}
+
+		Program::Assert(slots && slots->operators[operation], "No binary operator for the operands' types!");
+		AssignResult(destination.get_type(), destination, slots->operators[operation](lhs, rhs));
+	}
+
+	UnaryOperator GetUnaryOp(const Information& info, const UnaryOperation type)
+	{
+		const UnaryOperator unary_operator = FindUnaryOperator(type, info.index);
+
+		Program::Assert(unary_operator, "No unary operator for the type!");
+		return unary_operator;
+	}
+
+	BinaryOperator GetBinaryOp(const Information& lhs, const BinaryOperation type, const Information& rhs)
+	{
+		const BinaryOperator binary_operator = FindBinaryOperator(type, lhs.index, rhs.index);
+
+		Program::Assert(binary_operator, "No binary operator for the types!");
+		return binary_operator;
+	}
+
+	UnaryOperatorInto FindUnaryOpInto(const Information& info, const UnaryOperation type)
+	{
+		const UnarySlots* slots = UnarySlotsOf(type, info.index);
+		return slots ? slots->into[type].function : nullptr;
+	}
+
+	BinaryOperatorInto FindBinaryOpInto(const Information& lhs, const BinaryOperation type, const Information& rhs)
+	{
+		const BinarySlots* slots = BinarySlotsOf(type, lhs.index, rhs.index);
+		return slots ? slots->into[type].function : nullptr;
+	}
+
+	Index FindUnaryOpResult(const Information& info, const UnaryOperation type)
+	{
+		const UnarySlots* slots = UnarySlotsOf(type, info.index);
+		return slots ? slots->into[type].result : kInvalidType;
+	}
+
+	Index FindBinaryOpResult(const Information& lhs, const BinaryOperation type, const Information& rhs)
+	{
+		const BinarySlots* slots = BinarySlotsOf(type, lhs.index, rhs.index);
+		return slots ? slots->into[type].result : kInvalidType;
+	}
+
+	bool CanApply(const UnaryOperation operation, const Information& operand)
+	{
+		return FindUnaryOperator(operation, operand.index) != nullptr;
+	}
+
+	bool CanApply(const BinaryOperation operation, const Information& lhs, const Information& rhs)
+	{
+		return FindBinaryOperator(operation, lhs.index, rhs.index) != nullptr;
+	}
+
+	bool AddLazy(const Information& info, const Populator populator)
+	{
+		Program::Assert(Valid(info.index) && populator, "Invalid parameters!");
+
+		if constexpr (!kLazyOperatorTables)
+			return populator();
+
+		const std::lock_guard lock(RegistrationMutex());
+
+		RequireMutable();
+
+		return Require(lazy_ptr)[info.index].update([&](OS::Vector<Populator>& populators)
+		{
+			if (populators.empty())
+				lazy_pending_types.fetch_add(1, std::memory_order_relaxed);
+
+			populators.push_back(populator);
+			return true;
+		});
+	}
+
+	void ReportLazy()
+	{
+		static constexpr auto kLabel = L"Meta";
+
+		const u64 registering = register_nanoseconds.load(std::memory_order_relaxed);
+		const u64 populating = lazy_populate_nanoseconds.load(std::memory_order_relaxed);
+
+		Program::Log::Std(kLabel) << L"~~~~~ Lazy Tables ~~~~~" << std::endl;
+
+		if constexpr (!kLazyOperatorTables)
+		{
+			Program::Log::Std(kLabel) << L"Disabled, populators ran during registration" << std::endl;
+			return;
+		}
+
+		Program::Log::Std(kLabel) << L"Types still pending: " << lazy_pending_types.load(std::memory_order_relaxed) << std::endl;
+		Program::Log::Std(kLabel) << L"Types populated on demand: " << lazy_populated_types.load(std::memory_order_relaxed) << std::endl;
+		Program::Log::Std(kLabel) << L"Register() time: " << (registering / 1000) << L" us" << std::endl;
+
+		// The populators that did run would otherwise have run inside Register(), so their time is what startup saved
+		const u64 eager = std::max<u64>(registering + populating, 1);
+		Program::Log::Std(kLabel) << L"Populator time kept out of Register(): " << (populating / 1000) << L" us (" << (100 * populating / eager) << L"% of eager registration), pending types not yet counted" << std::endl;
+	}
+
+	void DumpInfo()
+	{
+		static constexpr auto kLabel = L"Meta";
+
+		Program::Log::Std(kLabel) << L"-------------------- Meta --------------------" << std::endl;
+		Program::Log::Std(kLabel) << L"~~~~~ Type List ~~~~" << std::endl;
+
+		const Index num_types = type_counter.load(std::memory_order_acquire);
+		Index digits = 0;
+		Index type_counter_copy = num_types;
+
+		while (type_counter_copy > 0)
+		{
+			type_counter_copy /= 10;
+			++digits;
+		}
+
+		const auto& infos = Require(infos_ptr);
+		const std::lock_guard lock(RegistrationMutex());
+
+		for (Index type = 0; type < num_types; ++type)
+		{
+			const Information& info = infos[type];
+			OS::Vector<Index> bases;
+
+			for (Index base = 0; base < num_types; ++base)
+			{
+				if (InheritsFrom(type, base))
+					bases.push_back(base);
+			}
+
+			Program::Log::Std(kLabel)
+				<< L"Type ID: " << std::setfill(L'0') << std::setw(int(digits)) << info.index
+				<< L" | Name: " << info.name;
+
+			if (!bases.empty())
+			{
+				Program::Log::Std() << L" | Bases: ";
+
+				for (std::size_t base_index = 0; base_index < bases.size(); ++base_index)
+				{
+					Program::Log::Std() << infos[bases[base_index]].name << L" ";
+
+					if (base_index + 1 < bases.size())
+						Program::Log::Std() << L", ";
+				}
+			}
+
+			if (IsRetiredUnlocked(type))
+				Program::Log::Std() << L" | Retired";
+
+			std::cout << std::endl;
+		}
+
+		Program::Log::Std(kLabel) << L"~~~~~ Type Stats ~~~~~" << std::endl;
+		Program::Log::Std(kLabel) << L"Number of types: " << num_types << std::endl;
+
+		if (std::size_t(num_types) > kPreallocationAmount)
+			Program::Log::Std(kLabel) << L"Recommendation: Set kPreallocationAmount to " << num_types << std::endl;
+
+		ReportLazy();
+
+		if constexpr (kRegistrationProfiling)
+			ReportRegistrationProfile();
+	}
+
+	// The initializer covers everything a META_TYPE did; types registered some other way are the sum of their parts
+	template<typename Field = u64>
+	static Field ProfileTotal(const ProfileRow& row, Field ProfileEntry::* field = &ProfileEntry::nanoseconds)
+	{
+		if (row[kProfile_Initializer].calls > 0)
+			return row[kProfile_Initializer].*field;
+
+		Field total = 0;
+
+		for (std::size_t category = kProfile_Register; category < kProfile_Lazy; ++category)
+			total += row[category].*field;
+
+		return total;
+	}
+
+	// Types with anything recorded, slowest first
+	static OS::Vector<std::pair<Index, ProfileRow>> SortedProfiles()
+	{
+		OS::Vector<std::pair<Index, ProfileRow>> sorted;
+
+		{
+			const std::lock_guard lock(profile_mutex);
+
+			for (std::size_t type = 0; type < profiles.size(); ++type)
+			{
+				if (ProfileTotal(profiles[type]) > 0 || profiles[type][kProfile_Lazy].calls > 0)
+					sorted.emplace_back(Index(type), profiles[type]);
+			}
+		}
+
+		std::stable_sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) { return ProfileTotal(a.second) > ProfileTotal(b.second); });
+		return sorted;
+	}
+
+	void ReportRegistrationProfile()
+	{
+		static constexpr auto kLabel = L"Meta";
+		static constexpr std::size_t kMaxRows = 20;
+
+		if constexpr (!kRegistrationProfiling)
+		{
+			Program::Log::Std(kLabel) << L"Registration profiling is off, see kRegistrationProfiling" << std::endl;
+			return;
+		}
+
+		const auto sorted = SortedProfiles();
+
+		u64 total_nanoseconds = 0;
+
+		for (const auto& [type, row] : sorted)
+			total_nanoseconds += ProfileTotal(row);
+
+		Program::Log::Std(kLabel) << L"~~~~~ Registration Profile ~~~~~" << std::endl;
+		Program::Log::Std(kLabel) << L"Total: " << (total_nanoseconds / 1000) << L" us over " << sorted.size() << L" types" << std::endl;
+
+		for (std::size_t row_index = 0; row_index < sorted.size() && row_index < kMaxRows; ++row_index)
+		{
+			const auto& [type, row] = sorted[row_index];
+
+			Program::Log::Std(kLabel)
+				<< (ProfileTotal(row) / 1000) << L" us | " << Require(infos_ptr)[type].name
+				<< L" | register " << (row[kProfile_Register].nanoseconds / 1000)
+				<< L" ctors " << (row[kProfile_Constructors].nanoseconds / 1000)
+				<< L" dtors " << (row[kProfile_Destructors].nanoseconds / 1000)
+				<< L" assigners " << (row[kProfile_Assigners].nanoseconds / 1000)
+				<< L" methods " << (row[kProfile_Methods].nanoseconds / 1000)
+				<< L" fields " << (row[kProfile_Fields].nanoseconds / 1000)
+				<< L" ops " << (row[kProfile_Operators].nanoseconds / 1000)
+				<< L" bases " << (row[kProfile_Inheritance].nanoseconds / 1000)
+				<< L" conversions " << (row[kProfile_Conversions].nanoseconds / 1000)
+				<< L" lazy " << (row[kProfile_Lazy].nanoseconds / 1000)
+				<< L" | allocations " << ProfileTotal(row, &ProfileEntry::allocations)
+				<< L'\n';
+		}
+
+		Program::Log::Std() << std::flush;
+	}
+
+	bool SaveRegistrationProfile(const char* csv_path)
+	{
+		static constexpr const wchar_t* kColumns[kProfile_Count] =
+		{
+			L"initializer", L"register", L"constructors", L"destructors", L"assigners", L"methods", L"fields", L"operators", L"inheritance", L"conversions", L"lazy"
+		};
+
+		std::wofstream csv(csv_path);
+
+		if (!csv)
+			return false;
+
+		csv << L"index,name,total_ns";
+
+		for (const auto* column : kColumns)
+			csv << L',' << column << L"_ns," << column << L"_allocations," << column << L"_calls";
+
+		csv << L'\n';
+
+		for (const auto& [type, row] : SortedProfiles())
+		{
+			csv << type << L',' << Require(infos_ptr)[type].name << L',' << ProfileTotal(row);
+
+			for (const ProfileEntry& entry : row)
+				csv << L',' << entry.nanoseconds << L',' << entry.allocations << L',' << entry.calls;
+
+			csv << L'\n';
+		}
+
+		return bool(csv);
+	}
+
+	OS::Vector<DispatchProfile> CollectDispatchProfile()
+	{
+		OS::Vector<DispatchProfile> profiles;
+
+		if constexpr (!kDispatchProfiling)
+			return profiles;
+
+		{
+			const std::lock_guard lock(dispatch_profile_mutex);
+
+			profiles = retired_dispatch_profiles;
+			DispatchPositions positions = PositionsOf(profiles);
+
+			for (const DispatchTable* table : dispatch_tables)
+				MergeDispatchTable(*table, profiles, positions);
+		}
+
+		std::stable_sort(profiles.begin(), profiles.end(), [](const DispatchProfile& a, const DispatchProfile& b) { return a.calls > b.calls; });
+		return profiles;
+	}
+
+	static u64 DroppedDispatches()
+	{
+		const std::lock_guard lock(dispatch_profile_mutex);
+
+		u64 dropped = retired_dispatch_dropped;
+
+		for (const DispatchTable* table : dispatch_tables)
+			dropped += table->dropped.load(std::memory_order_relaxed);
+
+		return dropped;
+	}
+
+	static Program::Name DispatchTypeName(const Index type)
+	{
+		return Valid(type) ? Require(infos_ptr)[type].name : Program::Name(L"?");
+	}
+
+	// What was dispatched on, as "Type.method(Parameter, ...)", "Type op 3 Other" or similar
+	static std::wstring DispatchDescription(const DispatchProfile& profile)
+	{
+		static constexpr const wchar_t* kOperations[kDispatch_Count] =
+		{
+			L"get constructor", L"get destructor", L"get assigner", L"construct", L"assign", L"invoke", L"unary op", L"binary op"
+		};
+
+		std::wstring description(DispatchTypeName(profile.type));
+
+		if (profile.operation == kDispatch_Invoke)
+			description.append(L".").append(profile.name);
+		else
+			description.append(L" ").append(kOperations[profile.operation]);
+
+		switch (profile.operation)
+		{
+		case kDispatch_UnaryOperator:
+			description.append(L" ").append(std::to_wstring(profile.detail));
+			break;
+
+		case kDispatch_BinaryOperator:
+			description.append(L" ").append(std::to_wstring(profile.detail)).append(L" ").append(DispatchTypeName(profile.other));
+			break;
+
+		case kDispatch_GetDestructor:
+			break;
+
+		default:
+		{
+			const FunctionSignature signature = GetSignature(profile.detail);
+			const auto* parameters = reinterpret_cast<const Parameter*>(signature.data());
+
+			description.append(L"(");
+
+			for (std::size_t parameter = 0; parameter < signature.size() / sizeof(Parameter); ++parameter)
+				description.append(parameter ? L", " : L"").append(DispatchTypeName(parameters[parameter].first));
+
+			description.append(L")");
+			break;
+		}
+		}
+
+		return description;
+	}
+
+	// Upper bound in nanoseconds of the bucket holding the given fraction of the samples
+	static u64 DispatchPercentile(const DispatchProfile& profile, const f64 fraction)
+	{
+		const u64 rank = u64(f64(profile.samples) * fraction);
+		u64 seen = 0;
+
+		for (std::size_t bucket = 0; bucket < kDispatchHistogramBuckets; ++bucket)
+		{
+			seen += profile.histogram[bucket];
+
+			if (seen > rank)
+				return u64(1) << bucket;
+		}
+
+		return u64(1) << (kDispatchHistogramBuckets - 1);
+	}
+
+	void ReportDispatchProfile(const std::size_t count)
+	{
+		static constexpr auto kLabel = L"Meta";
+
+		if constexpr (!kDispatchProfiling)
+		{
+			Program::Log::Std(kLabel) << L"Dispatch profiling is off, see kDispatchProfiling" << std::endl;
+			return;
+		}
+
+		const auto profiles = CollectDispatchProfile();
+
+		u64 total_calls = 0;
+
+		for (const DispatchProfile& profile : profiles)
+			total_calls += profile.calls;
+
+		Program::Log::Std(kLabel) << L"~~~~~ Dispatch Profile ~~~~~" << std::endl;
+		Program::Log::Std(kLabel) << L"Total: " << total_calls << L" calls over " << profiles.size() << L" dispatches, " << DroppedDispatches() << L" dropped" << std::endl;
+
+		for (std::size_t row = 0; row < profiles.size() && row < count; ++row)
+		{
+			const DispatchProfile& profile = profiles[row];
+
+			Program::Log::Std(kLabel) << profile.calls << L" calls | " << DispatchDescription(profile);
+
+			if (profile.samples > 0)
+			{
+				Program::Log::Std()
+					<< L" | mean " << (profile.nanoseconds / profile.samples)
+					<< L" ns p50 <" << DispatchPercentile(profile, 0.5)
+					<< L" ns p99 <" << DispatchPercentile(profile, 0.99)
+					<< L" ns over " << profile.samples << L" samples";
+			}
+
+			Program::Log::Std() << L'\n';
+		}
+
+		Program::Log::Std() << std::flush;
+	}
+
+	bool SaveDispatchProfile(const char* csv_path)
+	{
+		std::wofstream csv(csv_path);
+
+		if (!csv)
+			return false;
+
+		csv << L"type,operation,other,name,detail,description,calls,samples,total_ns";
+
+		for (std::size_t bucket = 0; bucket < kDispatchHistogramBuckets; ++bucket)
+			csv << L",under_" << (u64(1) << bucket) << L"_ns";
+
+		csv << L'\n';
+
+		for (const DispatchProfile& profile : CollectDispatchProfile())
+		{
+			csv << profile.type << L',' << int(profile.operation) << L',' << profile.other << L',' << profile.name << L',' << profile.detail
+				<< L",\"" << DispatchDescription(profile) << L"\"," << profile.calls << L',' << profile.samples << L',' << profile.nanoseconds;
+
+			for (const u64 samples : profile.histogram)
+				csv << L',' << samples;
+
+			csv << L'\n';
+		}
+
+		return bool(csv);
+	}
+
+	template<typename Vector>
+	static std::size_t VectorBytes(const Vector& vector)
+	{
+		return vector.capacity() * sizeof(typename Vector::value_type);
+	}
+
+	template<typename Vector>
+	static void AddVectorStats(TableStats& table, TypeStats& type_stats, std::size_t& count, const Vector& vector)
+	{
+		count += vector.size();
+
+		table.entries += vector.size();
+		table.bytes += VectorBytes(vector);
+
+		type_stats.table_bytes += VectorBytes(vector);
+	}
+
+	// Casters and converters are indexed by the other type, so only the non-null slots are entries
+	template<typename Vector>
+	static void AddSparseVectorStats(TableStats& table, TypeStats& type_stats, std::size_t& count, const Vector& vector)
+	{
+		const auto used = std::size_t(std::ranges::count_if(vector, [](const auto& entry) { return entry != nullptr; }));
+
+		count += used;
+
+		table.entries += used;
+		table.buckets += vector.size();
+		table.bytes += VectorBytes(vector);
+
+		type_stats.table_bytes += VectorBytes(vector);
+	}
+
+	RegistryStats GetRegistryStats()
+	{
+		enum : u8
+		{
+			kTable_Infos,
+			kTable_Names,
+			kTable_PerfectNames,
+			kTable_Constructors,
+			kTable_Assigners,
+			kTable_UnaryOps,
+			kTable_BinaryOps,
+			kTable_Casters,
+			kTable_Converters,
+			kTable_InPlaceConverters,
+			kTable_Hierarchy,
+			kTable_Signatures,
+			kTable_Frozen,
+
+			kTable_Count
+		};
+
+		static constexpr const char* kTableNames[kTable_Count] =
+		{
+			"infos", "names", "perfect_names", "constructors", "assigners", "unary_ops", "binary_ops", "casters", "converters", "in_place_converters", "hierarchy", "signatures", "frozen"
+		};
+
+		const std::lock_guard lock(RegistrationMutex());
+
+		RegistryStats stats;
+
+		stats.types = std::size_t(type_counter.load(std::memory_order_acquire));
+		stats.frozen = IsFrozenFast();
+		stats.lazy_pending_types = lazy_pending_types.load(std::memory_order_relaxed);
+		stats.lazy_populated_types = lazy_populated_types.load(std::memory_order_relaxed);
+		stats.memory = OS::Memory::GetStats();
+
+		auto& tables = stats.tables;
+		tables.resize(kTable_Count);
+
+		for (std::size_t table = 0; table < kTable_Count; ++table)
+			tables[table].name = kTableNames[table];
+
+		tables[kTable_Infos].entries = stats.types;
+		tables[kTable_Infos].bytes = stats.types * sizeof(Information);
+
+		const auto& names = Require(name_to_index_ptr);
+
+		tables[kTable_Names].entries = names.size();
+		tables[kTable_Names].buckets = names.capacity();
+		tables[kTable_Names].bytes = names.bytes();
+
+		const PerfectNameTable& perfect = perfect_names.read();
+
+		tables[kTable_PerfectNames].entries = perfect.slots.size();
+		tables[kTable_PerfectNames].buckets = perfect.displacements.size();
+		tables[kTable_PerfectNames].bytes = VectorBytes(perfect.slots) + VectorBytes(perfect.displacements);
+
+		const Hierarchy& current = CurrentHierarchy();
+
+		tables[kTable_Hierarchy].entries = current.nodes.size();
+		tables[kTable_Hierarchy].bytes = VectorBytes(current.nodes) + VectorBytes(current.anchors);
+
+		for (const auto& bases : direct_bases)
+			tables[kTable_Hierarchy].bytes += sizeof(bases) + VectorBytes(bases);
+
+		tables[kTable_Signatures].entries = signature_nodes.size();
+		tables[kTable_Signatures].buckets = signature_edges.capacity();
+		tables[kTable_Signatures].bytes = signature_edges.bytes();
+
+		for (std::size_t signature = 0; signature < signature_nodes.size(); ++signature)
+			tables[kTable_Signatures].bytes += sizeof(SignatureNode) + VectorBytes(signature_nodes[signature].parameters);
+
+		if (stats.frozen)
+		{
+			const FrozenTables& frozen_copy = Frozen();
+
+			tables[kTable_Frozen].entries = frozen_copy.infos.size();
+			tables[kTable_Frozen].bytes =
+				  VectorBytes(frozen_copy.sizes) + VectorBytes(frozen_copy.alignments) + VectorBytes(frozen_copy.destructors)
+				+ VectorBytes(frozen_copy.default_constructors) + VectorBytes(frozen_copy.copy_constructors) + VectorBytes(frozen_copy.move_constructors)
+				+ VectorBytes(frozen_copy.constructor_offsets) + VectorBytes(frozen_copy.constructors)
+				+ VectorBytes(frozen_copy.assigner_offsets) + VectorBytes(frozen_copy.assigners)
+				+ VectorBytes(frozen_copy.infos) + VectorBytes(frozen_copy.hierarchy.nodes) + VectorBytes(frozen_copy.hierarchy.anchors);
+		}
+
+		stats.per_type.reserve(stats.types);
+
+		for (Index type = 0; type < Index(stats.types); ++type)
+		{
+			const Information& info = Require(infos_ptr)[type];
+			TypeStats& type_stats = stats.per_type.emplace_back();
+
+			type_stats.type = type;
+			type_stats.name = info.name;
+			type_stats.size = info.size;
+
+			AddVectorStats(tables[kTable_Constructors], type_stats, type_stats.constructors, Require(constructors_ptr)[type].read());
+			AddVectorStats(tables[kTable_Assigners], type_stats, type_stats.assigners, Require(assigners_ptr)[type].read());
+
+			for (const auto& operation : Require(unary_ops_ptr)[type])
+				AddVectorStats(tables[kTable_UnaryOps], type_stats, type_stats.unary_ops, operation.read());
+
+			for (const auto& operation : Require(binary_ops_ptr)[type])
+				AddVectorStats(tables[kTable_BinaryOps], type_stats, type_stats.binary_ops, operation.read());
+
+			for (const auto& operation : Require(unary_ops_into_ptr)[type])
+				AddVectorStats(tables[kTable_UnaryOps], type_stats, type_stats.unary_ops, operation.read());
+
+			for (const auto& operation : Require(binary_ops_into_ptr)[type])
+				AddVectorStats(tables[kTable_BinaryOps], type_stats, type_stats.binary_ops, operation.read());
+
+			AddSparseVectorStats(tables[kTable_Casters], type_stats, type_stats.casters, Require(casters_ptr)[type].read());
+			AddSparseVectorStats(tables[kTable_Converters], type_stats, type_stats.converters, Require(converters_ptr)[type].read());
+			AddSparseVectorStats(tables[kTable_InPlaceConverters], type_stats, type_stats.in_place_converters, Require(in_place_converters_ptr)[type].read());
+
+			type_stats.lazy_pending = !Require(lazy_ptr)[type].read().empty();
+			type_stats.retired = IsRetiredUnlocked(type);
+
+			if (const auto* pool = ::Memory::find_allocator<::Memory::Pool>(type))
+				pool->stats(type_stats);
+
+			if (const auto* heap = ::Memory::find_allocator<::Memory::Heap>(type))
+				heap->stats(type_stats);
+		}
+
+		for (TableStats& table : tables)
+			table.load_factor = table.buckets > 0 ? double(table.entries) / double(table.buckets) : 0.0;
+
+		return stats;
+	}
+
+	// Type names can hold quotes and backslashes through template arguments, which both formats escape the same way
+	static void WriteEscaped(std::wostream& out, const Program::Name text)
+	{
+		for (const wchar_t character : text)
+		{
+			if (character == L'"' || character == L'\\')
+				out << L'\\';
+
+			out << character;
+		}
+	}
+
+	static void WriteRegistryJson(std::wostream& out, const RegistryStats& stats)
+	{
+		out << L"{\n";
+		out << L"  \"types\": " << stats.types << L",\n";
+		out << L"  \"frozen\": " << (stats.frozen ? L"true" : L"false") << L",\n";
+		out << L"  \"lazy\": { \"pending_types\": " << stats.lazy_pending_types << L", \"populated_types\": " << stats.lazy_populated_types << L" },\n";
+		out << L"  \"memory\": { \"cur_memory_used\": " << stats.memory.cur_memory_used
+			<< L", \"max_memory_used\": " << stats.memory.max_memory_used
+			<< L", \"cur_alignment_waste\": " << stats.memory.cur_alignment_waste
+			<< L", \"max_alignment_waste\": " << stats.memory.max_alignment_waste
+			<< L", \"untracked_reallocations\": " << stats.memory.untracked_reallocations
+			<< L", \"allocations\": " << stats.memory.allocations << L" },\n";
+
+		out << L"  \"tables\": [\n";
+
+		for (std::size_t table = 0; table < stats.tables.size(); ++table)
+		{
+			const TableStats& entry = stats.tables[table];
+
+			out << L"    { \"name\": \"" << entry.name
+				<< L"\", \"entries\": " << entry.entries
+				<< L", \"buckets\": " << entry.buckets
+				<< L", \"bytes\": " << entry.bytes
+				<< L", \"load_factor\": " << entry.load_factor
+				<< (table + 1 < stats.tables.size() ? L" },\n" : L" }\n");
+		}
+
+		out << L"  ],\n";
+		out << L"  \"per_type\": [\n";
+
+		for (std::size_t type = 0; type < stats.per_type.size(); ++type)
+		{
+			const TypeStats& entry = stats.per_type[type];
+
+			out << L"    { \"index\": " << entry.type << L", \"name\": \"";
+			WriteEscaped(out, entry.name);
+
+			out << L"\", \"size\": " << entry.size
+				<< L", \"live_objects\": " << entry.live_objects
+				<< L", \"pool_slots\": " << entry.pool_slots
+				<< L", \"pool_bytes\": " << entry.pool_bytes
+				<< L", \"heap_live\": " << entry.heap_live
+				<< L", \"heap_slots\": " << entry.heap_slots
+				<< L", \"heap_bytes\": " << entry.heap_bytes
+				<< L", \"heap_free_ranges\": " << entry.heap_free_ranges
+				<< L", \"heap_largest_free_range\": " << entry.heap_largest_free_range
+				<< L", \"heap_fragmentation\": " << entry.heap_fragmentation
+				<< L", \"constructors\": " << entry.constructors
+				<< L", \"assigners\": " << entry.assigners
+				<< L", \"unary_ops\": " << entry.unary_ops
+				<< L", \"binary_ops\": " << entry.binary_ops
+				<< L", \"casters\": " << entry.casters
+				<< L", \"converters\": " << entry.converters
+				<< L", \"in_place_converters\": " << entry.in_place_converters
+				<< L", \"table_bytes\": " << entry.table_bytes
+				<< L", \"lazy_pending\": " << (entry.lazy_pending ? L"true" : L"false")
+				<< L", \"retired\": " << (entry.retired ? L"true" : L"false")
+				<< (type + 1 < stats.per_type.size() ? L" },\n" : L" }\n");
+		}
+
+		out << L"  ]\n";
+		out << L"}\n";
+	}
+
+	static void WriteRegistryPrometheus(std::wostream& out, const RegistryStats& stats)
+	{
+		const auto gauge = [&](const wchar_t* metric, const wchar_t* help)
+		{
+			out << L"# HELP " << metric << L' ' << help << L'\n';
+			out << L"# TYPE " << metric << L" gauge\n";
+		};
+
+		gauge(L"meta_types", L"Registered types");
+		out << L"meta_types " << stats.types << L'\n';
+
+		gauge(L"meta_frozen", L"Whether the registry is frozen");
+		out << L"meta_frozen " << int(stats.frozen) << L'\n';
+
+		gauge(L"meta_retired_types", L"Types retired with their unloaded modules");
+		out << L"meta_retired_types " << std::count_if(stats.per_type.begin(), stats.per_type.end(), [](const TypeStats& type) { return type.retired; }) << L'\n';
+
+		gauge(L"meta_lazy_types", L"Types whose deferred tables are pending or were populated on demand");
+		out << L"meta_lazy_types{state=\"pending\"} " << stats.lazy_pending_types << L'\n';
+		out << L"meta_lazy_types{state=\"populated\"} " << stats.lazy_populated_types << L'\n';
+
+		gauge(L"meta_memory_bytes", L"Bytes tracked by OS::Memory");
+		out << L"meta_memory_bytes{kind=\"current\"} " << stats.memory.cur_memory_used << L'\n';
+		out << L"meta_memory_bytes{kind=\"max\"} " << stats.memory.max_memory_used << L'\n';
+		out << L"meta_memory_bytes{kind=\"alignment_waste\"} " << stats.memory.cur_alignment_waste << L'\n';
+
+		gauge(L"meta_memory_allocations", L"Allocations made through OS::Memory");
+		out << L"meta_memory_allocations " << stats.memory.allocations << L'\n';
+
+		const auto table_metric = [&](const wchar_t* metric, const wchar_t* help, auto field)
+		{
+			gauge(metric, help);
+
+			for (const TableStats& table : stats.tables)
+				out << metric << L"{table=\"" << table.name << L"\"} " << table.*field << L'\n';
+		};
+
+		table_metric(L"meta_table_entries", L"Entries per registry table", &TableStats::entries);
+		table_metric(L"meta_table_bytes", L"Estimated bytes per registry table", &TableStats::bytes);
+		table_metric(L"meta_table_load_factor", L"Entries per bucket of hashed registry tables", &TableStats::load_factor);
+
+		const auto type_metric = [&](const wchar_t* metric, const wchar_t* help, auto field)
+		{
+			gauge(metric, help);
+
+			for (const TypeStats& type : stats.per_type)
+			{
+				out << metric << L"{type=\"";
+				WriteEscaped(out, type.name);
+				out << L"\"} " << type.*field << L'\n';
+			}
+		};
+
+		type_metric(L"meta_type_live_objects", L"Live Handle objects per type", &TypeStats::live_objects);
+		type_metric(L"meta_type_pool_slots", L"Pool capacity in objects per type", &TypeStats::pool_slots);
+		type_metric(L"meta_type_pool_bytes", L"Pool bytes per type", &TypeStats::pool_bytes);
+		type_metric(L"meta_type_heap_bytes", L"Heap bytes per type", &TypeStats::heap_bytes);
+		type_metric(L"meta_type_heap_fragmentation", L"1 - largest free range / free slots of each type's heap", &TypeStats::heap_fragmentation);
+		type_metric(L"meta_type_table_bytes", L"Estimated bytes of each type's dispatch tables", &TypeStats::table_bytes);
+	}
+
+	bool SaveRegistryStats(const char* path, const StatsFormat format)
+	{
+		const RegistryStats stats = GetRegistryStats();
+		std::wofstream out(path);
+
+		if (!out)
+			return false;
+
+		if (format == kStatsFormat_Prometheus)
+			WriteRegistryPrometheus(out, stats);
+		else
+			WriteRegistryJson(out, stats);
+
+		return bool(out);
+	}
+
+	static void ReserveFrozen(FrozenTables& tables, const std::size_t count)
+	{
+		tables.sizes.reserve(count);
+		tables.alignments.reserve(count);
+		tables.destructors.reserve(count);
+		tables.default_constructors.reserve(count);
+		tables.copy_constructors.reserve(count);
+		tables.move_constructors.reserve(count);
+		tables.constructor_offsets.reserve(count + 1);
+		tables.assigner_offsets.reserve(count + 1);
+		tables.infos.reserve(count);
+	}
+
+	// Adds the type's row at the end of the tables, whatever its index
+	static void AppendFrozen(FrozenTables& tables, const Information& info)
+	{
+		tables.infos.push_back(info);
+
+		tables.sizes.push_back(info.size);
+		tables.alignments.push_back(info.alignment);
+		tables.destructors.push_back(Require(destructors_ptr)[info.index].load(std::memory_order_acquire));
+
+		Constructor default_constructor = nullptr;
+		Constructor copy_constructor = nullptr;
+		Constructor move_constructor = nullptr;
+
+		tables.constructor_offsets.push_back(u32(tables.constructors.size()));
+
+		for (const auto& [signature, constructor] : Require(constructors_ptr)[info.index].read())
+		{
+			if (signature == kEmptySignature)
+				default_constructor = constructor;
+			else if (IsSingleParameter(signature, info.index, kQualifier_Constant | kQualifier_Reference))
+				copy_constructor = constructor;
+			else if (IsSingleParameter(signature, info.index, kQualifier_Temporary))
+				move_constructor = constructor;
+
+			tables.constructors.push_back({ signature, constructor });
+		}
+
+		// Entries stay sorted by signature ID from the map
+		tables.default_constructors.push_back(default_constructor);
+		tables.copy_constructors.push_back(copy_constructor);
+		tables.move_constructors.push_back(move_constructor);
+
+		tables.assigner_offsets.push_back(u32(tables.assigners.size()));
+
+		for (const auto& [signature, assigner] : Require(assigners_ptr)[info.index].read())
+			tables.assigners.push_back({ signature, assigner });
+	}
+
+	// Terminates the last type's signature ranges
+	static void CloseFrozen(FrozenTables& tables)
+	{
+		tables.constructor_offsets.push_back(u32(tables.constructors.size()));
+		tables.assigner_offsets.push_back(u32(tables.assigners.size()));
+	}
+
+	void Freeze()
+	{
+		const std::lock_guard lock(RegistrationMutex());
+
+		Program::Assert(!IsFrozenFast(), "The registry is already frozen!");
+
+		// Lazy tables can no longer be filled once frozen
+		for (Index type = 0; type < type_counter.load(std::memory_order_relaxed); ++type)
+			Populate(type);
+
+		const auto& infos = Require(infos_ptr);
+		FrozenTables tables;
+
+		ReserveFrozen(tables, infos.size());
+
+		for (std::size_t type = 0; type < infos.size(); ++type)
+			AppendFrozen(tables, infos[type]);
+
+		CloseFrozen(tables);
+
+		tables.hierarchy = CurrentHierarchy();
+
+		frozen_versions.push_back(std::make_unique<FrozenTables>(std::move(tables)));
+		frozen_tables.store(frozen_versions.back().get(), std::memory_order_release);
+		frozen.store(true, std::memory_order_release);
+
+		BuildPerfectNameTable();
+	}
+
+	void Thaw()
+	{
+		const std::lock_guard lock(RegistrationMutex());
+
+		// The tables stay alive for readers still using them, and are only replaced by the next Freeze()
+		frozen.store(false, std::memory_order_release);
+	}
+
+	bool IsFrozen()
+	{
+		return IsFrozenFast();
+	}
+
+	u64 RegistryGeneration()
+	{
+		return registry_generation.load(std::memory_order_acquire);
+	}
+
+	struct RegistryTables
+	{
+		FrozenTables tables; // Rows in local index order
+		OS::Vector<std::pair<Index, LocalIndex>> locals; // Sorted by global index
+	};
+
+	// One per thread that has read a context, reused once the thread exits. Holds the context epoch its current lookup
+	// started in, or zero between lookups.
+	struct ContextReader
+	{
+		std::atomic<u64> epoch = 0;
+		std::atomic<bool> claimed = false;
+		u32 depth = 0; // Owning thread only
+	};
+
+	constinit static OS::StableVector<ContextReader> context_readers;
+	static std::atomic<u64> context_epoch = 1;
+
+	static ContextReader& ThisContextReader()
+	{
+		struct Claim
+		{
+			ContextReader* reader = nullptr;
+
+			Claim()
+			{
+				const std::lock_guard lock(RegistrationMutex());
+
+				for (std::size_t slot = 0; slot < context_readers.size() && !reader; ++slot)
+				{
+					bool expected = false;
+
+					if (context_readers[slot].claimed.compare_exchange_strong(expected, true, std::memory_order_acquire))
+						reader = &context_readers[slot];
+				}
+
+				if (!reader)
+				{
+					reader = &context_readers.emplace_back();
+					reader->claimed.store(true, std::memory_order_relaxed);
+				}
+			}
+
+			~Claim() { reader->claimed.store(false, std::memory_order_release); }
+
+			Claim(const Claim&) = delete;
+			Claim(Claim&&) = delete;
+			Claim& operator=(const Claim&) = delete;
+			Claim& operator=(Claim&&) = delete;
+		};
+
+		thread_local Claim claim;
+		return *claim.reader;
+	}
+
+	// Keeps the tables a lookup reads alive until it returns. Tables replaced while any thread is still in the epoch
+	// they were retired in, or an earlier one, wait for the next rebuild to be freed.
+	class ContextReadScope
+	{
+	public:
+		ContextReadScope()
+			: reader(ThisContextReader())
+		{
+			if (reader.depth++ == 0)
+				reader.epoch.store(context_epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+		}
+
+		~ContextReadScope()
+		{
+			if (--reader.depth == 0)
+				reader.epoch.store(0, std::memory_order_release);
+		}
+
+		ContextReadScope(const ContextReadScope&) = delete;
+		ContextReadScope(ContextReadScope&&) = delete;
+		ContextReadScope& operator=(const ContextReadScope&) = delete;
+		ContextReadScope& operator=(ContextReadScope&&) = delete;
+
+	private:
+		ContextReader& reader;
+	};
+
+	struct RegistryState
+	{
+		const bool everything;
+
+		// Context generation last checked against, zero when a type was added since. Readers compare it lock-free.
+		std::atomic<u64> checked = 0;
+
+		// Writers only from here on
+		u64 built = 0; // Context generation the current tables were built at
+		bool added = false; // A type joined since, whose own stamp may be older than the tables
+		OS::Vector<Index> types; // Local to global
+
+		std::atomic<const RegistryTables*> current = nullptr;
+		std::unique_ptr<RegistryTables> owned;
+		OS::Vector<std::pair<std::unique_ptr<RegistryTables>, u64>> retired; // With the epoch they were retired in
+	};
+
+	static bool ContextStale(const RegistryState& state)
+	{
+		if (state.added || !state.current.load(std::memory_order_relaxed))
+			return true;
+
+		if (state.everything && state.types.size() < std::size_t(type_counter.load(std::memory_order_relaxed)))
+			return true;
+
+		const auto& stamps = Require(context_stamps_ptr);
+		return std::any_of(state.types.begin(), state.types.end(), [&](const Index type) { return stamps[type].load(std::memory_order_relaxed) > state.built; });
+	}
+
+	// Frees the retired tables that no lookup can still be reading
+	static void ReclaimContext(RegistryState& state)
+	{
+		u64 oldest = std::numeric_limits<u64>::max();
+
+		for (std::size_t slot = 0; slot < context_readers.size(); ++slot)
+		{
+			if (const u64 epoch = context_readers[slot].epoch.load(std::memory_order_seq_cst); epoch != 0)
+				oldest = std::min(oldest, epoch);
+		}
+
+		std::erase_if(state.retired, [&](const auto& entry) { return entry.second < oldest; });
+	}
+
+	// Assigners are copied as they are, so types with lazy tables get theirs when a lookup asks for them
+	static void RebuildContext(RegistryState& state)
+	{
+		const auto& infos = Require(infos_ptr);
+
+		if (state.everything)
+		{
+			for (Index type = Index(state.types.size()); type < type_counter.load(std::memory_order_relaxed); ++type)
+				state.types.push_back(type);
+		}
+
+		auto next = std::make_unique<RegistryTables>();
+
+		ReserveFrozen(next->tables, state.types.size());
+		next->locals.reserve(state.types.size());
+
+		for (std::size_t local = 0; local < state.types.size(); ++local)
+		{
+			AppendFrozen(next->tables, infos[state.types[local]]);
+			next->locals.emplace_back(state.types[local], LocalIndex(local));
+		}
+
+		CloseFrozen(next->tables);
+		std::sort(next->locals.begin(), next->locals.end());
+
+		state.current.store(next.get(), std::memory_order_seq_cst);
+
+		if (state.owned)
+			state.retired.emplace_back(std::move(state.owned), context_epoch.fetch_add(1, std::memory_order_seq_cst));
+
+		state.owned = std::move(next);
+		state.built = context_generation.load(std::memory_order_relaxed);
+		state.added = false;
+
+		ReclaimContext(state);
+	}
+
+	// Call inside a ContextReadScope, which the returned tables live for
+	static const RegistryTables& CurrentContext(RegistryState& state)
+	{
+		if (state.checked.load(std::memory_order_acquire) != context_generation.load(std::memory_order_acquire)) [[unlikely]]
+		{
+			const std::lock_guard lock(RegistrationMutex());
+
+			const u64 generation = context_generation.load(std::memory_order_relaxed);
+
+			if (state.checked.load(std::memory_order_relaxed) != generation)
+			{
+				if (ContextStale(state))
+					RebuildContext(state);
+
+				state.checked.store(generation, std::memory_order_release);
+			}
+		}
+
+		return *state.current.load(std::memory_order_seq_cst);
+	}
+
+	static LocalIndex RequireLocal(const RegistryTables& tables, const LocalIndex local)
+	{
+		Program::Assert(std::size_t(local) < tables.tables.infos.size(), "Type is not in the registry!");
+		return local;
+	}
+
+	Registry::Registry()
+		: Registry(false)
+	{
+	}
+
+	Registry::Registry(const bool everything)
+		: state(std::make_unique<RegistryState>(everything))
+	{
+	}
+
+	Registry::~Registry() = default;
+
+	Registry& Registry::Global()
+	{
+		static Registry global(true);
+		return global;
+	}
+
+	LocalIndex Registry::Add(const Information& info)
+	{
+		Program::Assert(Valid(info.index), "Invalid type!");
+
+		if (state->everything)
+			return info.index;
+
+		const std::lock_guard lock(RegistrationMutex());
+
+		const auto iterator = std::find(state->types.begin(), state->types.end(), info.index);
+
+		if (iterator != state->types.end())
+			return LocalIndex(std::distance(state->types.begin(), iterator));
+
+		state->types.push_back(info.index);
+		state->added = true;
+		state->checked.store(0, std::memory_order_release);
+
+		return LocalIndex(state->types.size() - 1);
+	}
+
+	std::size_t Registry::size() const
+	{
+		const ContextReadScope scope;
+		return CurrentContext(*state).tables.infos.size();
+	}
+
+	LocalIndex Registry::Local(const Information& info) const
+	{
+		const ContextReadScope scope;
+		const auto& locals = CurrentContext(*state).locals;
+		const auto iterator = std::lower_bound(locals.begin(), locals.end(), std::pair(info.index, LocalIndex(0)));
+
+		return iterator != locals.end() && iterator->first == info.index ? iterator->second : kInvalidType;
+	}
+
+	// The registry's own Information, since the context's copy goes away with its tables
+	const Information& Registry::GetType(const LocalIndex local) const
+	{
+		const ContextReadScope scope;
+		const RegistryTables& tables = CurrentContext(*state);
+		return Require(infos_ptr)[tables.tables.infos[RequireLocal(tables, local)].index];
+	}
+
+	std::size_t Registry::SizeOf(const LocalIndex local) const
+	{
+		const ContextReadScope scope;
+		const RegistryTables& tables = CurrentContext(*state);
+		return tables.tables.sizes[RequireLocal(tables, local)];
+	}
+
+	std::size_t Registry::AlignmentOf(const LocalIndex local) const
+	{
+		const ContextReadScope scope;
+		const RegistryTables& tables = CurrentContext(*state);
+		return tables.tables.alignments[RequireLocal(tables, local)];
+	}
+
+	Destructor Registry::GetDestructor(const LocalIndex local) const
+	{
+		const ContextReadScope scope;
+		const RegistryTables& tables = CurrentContext(*state);
+		const Destructor destructor = tables.tables.destructors[RequireLocal(tables, local)];
+
+		Program::Assert(destructor, "No destructor specified!");
+		return destructor;
+	}
+
+	Constructor Registry::GetConstructor(const LocalIndex local, const FunctionSignature signature) const
+	{
+		return GetConstructor(local, FindSignature(signature));
+	}
+
+	Constructor Registry::GetConstructor(const LocalIndex local, const SignatureId signature) const
+	{
+		const ContextReadScope scope;
+		const RegistryTables& tables = CurrentContext(*state);
+		const Index type = tables.tables.infos[RequireLocal(tables, local)].index;
+		const Constructor constructor = FindFrozenConstructor(tables.tables, local, type, signature);
+
+		Program::Assert(constructor, "No constructor with the specified signature!");
+		return constructor;
+	}
+
+	Assigner Registry::GetAssigner(const LocalIndex local, const FunctionSignature signature) const
+	{
+		return GetAssigner(local, FindSignature(signature));
+	}
+
+	Assigner Registry::GetAssigner(const LocalIndex local, const SignatureId signature) const
+	{
+		const ContextReadScope scope;
+		const RegistryTables& unpopulated = CurrentContext(*state);
+
+		// Filling a lazy table stamps the type, so the tables read below already have its assigners
+		Populate(unpopulated.tables.infos[RequireLocal(unpopulated, local)].index);
+
+		const RegistryTables& tables = CurrentContext(*state);
+		const Assigner assigner = FindFrozen(tables.tables.assigner_offsets, tables.tables.assigners, RequireLocal(tables, local), signature);
+
+		Program::Assert(assigner, "No assigner with the specified signature!");
+		return assigner;
+	}
+
+	// Function pointers go through void* to ask the loader which library owns them
+	template<typename Function>
+	static bool InModule(const Module& module, const Function function)
+	{
+		return function && module.library.contains(reinterpret_cast<const void*>(function));
+	}
+
+	// Publishes a pruned copy only when something in the table has to go
+	template<typename Table, typename Predicate>
+	static void Prune(Published<Table>& published, const bool clear, Predicate&& dangling)
+	{
+		const Table& table = published.read();
+
+		if (clear ? table.empty() : std::none_of(table.begin(), table.end(), dangling))
+			return;
+
+		published.update([&](Table& pruned)
+		{
+			if (clear)
+				pruned.clear();
+			else
+				std::erase_if(pruned, dangling);
+
+			return true;
+		});
+	}
+
+	// Casters and converters are indexed by target type, so entries are nulled rather than erased
+	template<typename Function>
+	static void PruneByTarget(Published<OS::Vector<Function>>& published, const bool clear, const Module& module)
+	{
+		const auto dangling = [&](const OS::Vector<Function>& table, const std::size_t target)
+		{
+			return table[target] && (clear || IsRetiredUnlocked(Index(target)) || InModule(module, table[target]));
+		};
+
+		const OS::Vector<Function>& table = published.read();
+		bool any = false;
+
+		for (std::size_t target = 0; target < table.size() && !any; ++target)
+			any = dangling(table, target);
+
+		if (!any)
+			return;
+
+		published.update([&](OS::Vector<Function>& pruned)
+		{
+			for (std::size_t target = 0; target < pruned.size(); ++target)
+			{
+				if (dangling(pruned, target))
+					pruned[target] = nullptr;
+			}
+
+			return true;
+		});
+	}
+
+	ModuleId LoadModule(const char* path)
+	{
+		const std::lock_guard lock(RegistrationMutex());
+
+		RequireMutable();
+		Program::Assert(loading_module == kInvalidModule, "Modules can't load other modules from their initializers!");
+
+		modules.emplace_back();
+		const auto module = ModuleId(modules.size());
+
+		// The library's static initializers run inside the loader on this thread, so all they register is the module's
+		loading_module = module;
+		OS::SharedLibrary library(path);
+		loading_module = kInvalidModule;
+
+		if (!library.loaded())
+			return kInvalidModule;
+
+		modules[module - 1].library = std::move(library);
+		return module;
+	}
+
+	bool UnloadModule(const ModuleId module)
+	{
+		const std::lock_guard lock(RegistrationMutex());
+
+		if (IsFrozenFast() || module == kInvalidModule || module > modules.size() || !modules[module - 1].library.loaded())
+			return false;
+
+		const Module& unloading = modules[module - 1];
+
+		// Live objects would outlive their destructors
+		for (const Index type : unloading.types)
+		{
+			TypeStats live;
+
+			if (const auto* pool = ::Memory::find_allocator<::Memory::Pool>(type))
+				pool->stats(live);
+
+			if (const auto* heap = ::Memory::find_allocator<::Memory::Heap>(type))
+				heap->stats(live);
+
+			if (live.live_objects > 0 || live.heap_live > 0)
+				return false;
+		}
+
+		const Index count = type_counter.load(std::memory_order_relaxed);
+		auto& infos = Require(infos_ptr);
+
+		retired_types.resize(count, false);
+
+		for (const Index type : unloading.types)
+		{
+			retired_types[type] = true;
+
+			if (infos[type].id != kInvalidTypeId)
+				Require(type_ids_ptr).erase(infos[type].id);
+
+			if (std::size_t(type) < direct_bases.size())
+				direct_bases[type].clear();
+		}
+
+		const auto dangling_entry = [&](const auto& entry)
+		{
+			return InModule(unloading, entry.second);
+		};
+
+		const auto dangling_into = [&](const auto& entry)
+		{
+			return InModule(unloading, entry.second.function) || IsRetiredUnlocked(entry.second.result);
+		};
+
+		// Every type is checked since any module may have added to types it doesn't own
+		for (Index type = 0; type < count; ++type)
 		{
-			if (range.empty())
-				return;
+			const bool retired = IsRetiredUnlocked(type);
 
-			const Meta::Information& info = Require(Meta::GetType(type));
+			Prune(Require(constructors_ptr)[type], retired, dangling_entry);
+			Prune(Require(assigners_ptr)[type], retired, dangling_entry);
 
-			for (Index index = range.start; index < range.end; ++index)
-				Meta::GetDestructor(info)(View(get(index), info, Meta::kQualifier_Reference));
+			for (auto& operation : Require(unary_ops_ptr)[type])
+				Prune(operation, retired, dangling_entry);
 
-			std::fill(std::next(used.begin(), range.start), std::next(used.begin(), range.end), false);
-			queue.push(range);
+			for (auto& operation : Require(binary_ops_ptr)[type])
+				Prune(operation, retired, dangling_entry);
 
-			num_allocated -= range.size();
-		}
+			for (auto& operation : Require(unary_ops_into_ptr)[type])
+				Prune(operation, retired, dangling_into);
 
-		void* get(const Index index)
-		{
-			return used[index] ? static_cast<u8*>(data) + (std::size_t(index) * Meta::GetType(type)->size) : nullptr;
-		}
+			for (auto& operation : Require(binary_ops_into_ptr)[type])
+				Prune(operation, retired, dangling_into);
 
-	private:
-		void* data = nullptr;
-		std::size_t capacity = 0;
+			Require(operator_rows_ptr)[type].built.store(false, std::memory_order_release);
+			ContextTablesChanged(type);
 
-		OS::BitVector used;
-		std::priority_queue<Range, std::deque<Range, OS::Memory::Allocator<Range>>, RangeComparator> queue;
+			PruneByTarget(Require(casters_ptr)[type], retired, unloading);
+			PruneByTarget(Require(converters_ptr)[type], retired, unloading);
+			PruneByTarget(Require(in_place_converters_ptr)[type], retired, unloading);
 
-		std::size_t num_allocated = 0;
+			// Names interned from the module's literals would dangle along with its methods
+			const auto dangling_method_set = [&](const MethodSet& set)
+			{
+				return unloading.library.contains(set.name.data()) || std::any_of(set.overloads.begin(), set.overloads.end(), dangling_entry)
+					|| std::any_of(set.into.begin(), set.into.end(), dangling_entry);
+			};
 
-		Meta::Index type;
-	};
-}
+			if (auto& methods = Require(methods_ptr)[type]; retired ? !methods.read().empty() : std::any_of(methods.read().begin(), methods.read().end(), dangling_method_set))
+			{
+				methods.update([&](MethodsMap& sets)
+				{
+					if (retired)
+						sets.clear();
 
-namespace Meta
-{
-	std::pair<OS::Vector<Information>*, Index> Register(const Program::Name name, const std::size_t alignment, const std::size_t size)
-	{
-		static auto infos         = PreallocateContainer<std::remove_pointer_t<decltype(infos_ptr)>>();
-		static auto name_to_index = PreallocateContainer<std::remove_pointer_t<decltype(name_to_index_ptr)>>();
-		static auto singletons    = PreallocateContainer<std::remove_pointer_t<decltype(singletons_ptr)>>();
+					for (MethodSet& set : sets)
+					{
+						if (unloading.library.contains(set.name.data()))
+						{
+							set.overloads.clear();
+							set.into.clear();
+						}
+						else
+						{
+							std::erase_if(set.overloads, dangling_entry);
+							std::erase_if(set.into, dangling_entry);
+						}
+					}
 
-		static auto casters       = PreallocateContainer<std::remove_pointer_t<decltype(casters_ptr)>>();
-		static auto converters    = PreallocateContainer<std::remove_pointer_t<decltype(converters_ptr)>>();
+					std::erase_if(sets, [](const MethodSet& set) { return set.overloads.empty(); });
+					return true;
+				});
+			}
 
-		static auto constructors = PreallocateContainer<std::remove_pointer_t<decltype(constructors_ptr)>>();
-		static auto destructors  = PreallocateContainer<std::remove_pointer_t<decltype(destructors_ptr)>>();
-		static auto assigners    = PreallocateContainer<std::remove_pointer_t<decltype(assigners_ptr)>>();
-		static auto unary_ops    = PreallocateContainer<std::remove_pointer_t<decltype(unary_ops_ptr)>>();
-		static auto binary_ops   = PreallocateContainer<std::remove_pointer_t<decltype(binary_ops_ptr)>>();
+			Prune(Require(fields_ptr)[type], retired, [&](const Field& field)
+			{
+				return IsRetiredUnlocked(field.type) || unloading.library.contains(field.name.data()) || InModule(unloading, field.copier);
+			});
 
-		static bool initialized = false;
+			auto& destructor = Require(destructors_ptr)[type];
 
-		if (!initialized) [[unlikely]]
-		{
-			// Must be set before calls below to prevent the recursion from going any further
-			initialized = true;
+			if (retired || InModule(unloading, destructor.load(std::memory_order_relaxed)))
+				destructor.store(nullptr, std::memory_order_release);
 
-			infos_ptr = &infos;
-			name_to_index_ptr = &name_to_index;
-			singletons_ptr = &singletons;
+			auto& pending = Require(lazy_ptr)[type];
+			const bool was_pending = !pending.read().empty();
 
-			casters_ptr = &casters;
-			converters_ptr = &converters;
+			Prune(pending, retired, [&](const Populator populator) { return InModule(unloading, populator); });
 
-			constructors_ptr = &constructors;
-			destructors_ptr = &destructors;
-			assigners_ptr = &assigners;
-			unary_ops_ptr = &unary_ops;
-			binary_ops_ptr = &binary_ops;
+			if (was_pending && pending.read().empty())
+				lazy_pending_types.fetch_sub(1, std::memory_order_relaxed);
 
-			Program::Assert(AddPrimitiveIntegralType<u8>(),  "Error in initializing u8 into the Meta system!");
-			Program::Assert(AddPrimitiveIntegralType<u16>(), "Error in initializing u16 into the Meta system!");
-			Program::Assert(AddPrimitiveIntegralType<u32>(), "Error in initializing u32 into the Meta system!");
-			Program::Assert(AddPrimitiveIntegralType<u64>(), "Error in initializing u64 into the Meta system!");
-			Program::Assert(AddPrimitiveIntegralType<i8>(),  "Error in initializing i8 into the Meta system!");
-			Program::Assert(AddPrimitiveIntegralType<i16>(), "Error in initializing i16 into the Meta system!");
-			Program::Assert(AddPrimitiveIntegralType<i32>(), "Error in initializing i32 into the Meta system!");
-			Program::Assert(AddPrimitiveIntegralType<i64>(), "Error in initializing i64 into the Meta system!");
-			Program::Assert(AddPrimitiveFloatType<f32>(),    "Error in initializing f32 into the Meta system!");
-			Program::Assert(AddPrimitiveFloatType<f64>(),    "Error in initializing f64 into the Meta system!");
-			Program::Assert(AddPOD<bool>(),                  "Error in initializing bool into the Meta system!");
-			Program::Assert(AddPOD<View>(),                  "Error in initializing View into the Meta system!");
-			Program::Assert(AddPOD<Handle>(),                "Error in initializing Handle into the Meta system!");
+			auto& singleton = Require(singletons_ptr)[type];
+			const View& current = singleton.read();
+
+			if (current.valid() && (retired || IsRetiredUnlocked(current.type) || unloading.library.contains(current.internal())))
+			{
+				singleton.update([](View& cleared)
+				{
+					cleared = View();
+					return true;
+				});
+			}
 		}
 
-		// ReSharper disable once CppDFAUnusedValue
-		Index index = kInvalidType;
+		Require(name_to_index_ptr).erase_if([](const Information& info) { return IsRetiredUnlocked(info.index); });
 
-		if (name_to_index.empty() || !name_to_index.contains(name))
+		if (!perfect_names.read().slots.empty())
 		{
-			index = type_counter++;
-
-			infos.push_back(Information
+			perfect_names.update([](PerfectNameTable& table)
+			{
+				for (const Information*& slot : table.slots)
 				{
-					  .index = index
-					, .name = name
-					, .alignment = alignment
-					, .size = size
+					if (IsRetiredUnlocked(slot->index))
+						slot = &kRetiredInformation;
 				}
-			);
-
-			name_to_index.insert_or_assign(name, index);
-			singletons.emplace_back();
-
-			casters.emplace_back();
-			casters.back().reserve(kPreallocationAmount);
-			converters.emplace_back();
-			converters.back().reserve(kPreallocationAmount);
-
-			constructors.emplace_back();
-			constructors.back().reserve(kPreallocationAmount);
-			destructors.push_back(nullptr);
-			assigners.emplace_back();
-			assigners.back().reserve(kPreallocationAmount);
-			unary_ops.emplace_back();
-			unary_ops.back().reserve(kPreallocationAmount);
-			binary_ops.emplace_back();
-			binary_ops.back().reserve(kPreallocationAmount);
+
+				return true;
+			});
 		}
-		else
-			index = name_to_index.find(name)->second;
 
-		return { &infos, index };
-	}
+		// Names interned straight from the library's literals move to the name pool before it unmaps
+		for (const Index type : unloading.types)
+		{
+			Information& info = infos[type];
 
-	Index Find(const Program::Name name)
-	{
-		const auto iterator = Require(name_to_index_ptr).find(name);
+			if (unloading.library.contains(info.name.data()))
+			{
+				const Program::Name literal = info.name;
 
-		if (iterator == Require(name_to_index_ptr).end())
-			return kInvalidType;
+				Program::ForgetName(literal);
+				info.name = Program::StringName(literal.data(), literal.size());
+			}
+		}
 
-		return iterator->second;
-	}
+		hierarchy_stale.store(true, std::memory_order_release);
+		registry_generation.fetch_add(1, std::memory_order_release);
 
-	const Information* GetType(const Index type)
-	{
-		Program::Assert(type > kInvalidType && type <= type_counter, "Type index out of bounds!");
-		return &Require(infos_ptr)[type];
+		modules[module - 1].library.close();
+		return true;
 	}
 
-	bool Valid(const Index type_index)
+	bool IsRetired(const Information& info)
 	{
-		return type_index > kInvalidType && type_index <= type_counter;
+		const std::lock_guard lock(RegistrationMutex());
+		return IsRetiredUnlocked(info.index);
 	}
 
-	bool AddCaster(const Information& info_a, const Information& info_b, const Caster caster_ab)
-	{
-		Program::Assert(Valid(info_a.index) && Valid(info_b.index) && caster_ab, "Invalid parameters!");
-
-		auto& casters = Require(casters_ptr);
+	// Snapshot layout, in native byte order:
+	// SnapshotHeader | SnapshotType[type_count] | u32 direct_bases[base_count] | u32 displacements[bucket_count]
+	// | u32 slots[type_count, only if bucket_count > 0] | wchar_t names[name_length]
+	static constexpr u32 kSnapshotMagic = 0x504E534D; // "MSNP"
+	static constexpr u32 kSnapshotVersion = 2;
 
-		if (casters[info_a.index].size() < info_b.index + 1)
-			casters[info_a.index].resize(info_b.index + 1, nullptr);
+	struct SnapshotHeader
+	{
+		u32 magic = kSnapshotMagic;
+		u32 version = kSnapshotVersion;
+		u64 fingerprint = 0;
+		u32 wchar_size = sizeof(wchar_t);
+		u32 type_count = 0;
+		u32 name_length = 0;
+		u32 base_count = 0;
+		u32 bucket_count = 0;
+		u32 reserved = 0;
+	};
 
-		casters[info_a.index][info_b.index] = caster_ab;
+	struct SnapshotType
+	{
+		u64 alignment = 0;
+		u64 size = 0;
+		u64 id = kInvalidTypeId;
+		u32 name_offset = 0;
+		u32 name_length = 0;
+		u32 base_offset = 0;
+		u32 base_count = 0;
+	};
 
-		return true;
-	}
+	static_assert(std::is_trivially_copyable_v<SnapshotHeader> && std::is_trivially_copyable_v<SnapshotType>);
 
-	bool IsCastableTo(const Information& info_a, const Information& info_b)
+	template<typename T>
+	static void WriteSnapshotArray(std::ofstream& file, const OS::Vector<T>& array)
 	{
-		const auto& casters = Require(casters_ptr);
-		return Valid(info_a.index) && Valid(info_b.index) && info_b.index < Index(casters[info_a.index].size()) && casters[info_a.index][info_b.index];
+		file.write(reinterpret_cast<const char*>(array.data()), std::streamsize(array.size() * sizeof(T)));
 	}
 
-	Caster GetCaster(const Information& info_a, const Information& info_b)
+	bool SaveSnapshot(const char* path)
 	{
-		Program::Assert(IsCastableTo(info_a, info_b), "Cannot cast from A to B!");
-		return Require(casters_ptr)[info_a.index][info_b.index];
-	}
+		const std::lock_guard lock(RegistrationMutex());
 
-	bool AddConverter(const Information& info_a, const Information& info_b, const Converter converter_ab)
-	{
-		auto& converters = Require(converters_ptr);
+		const auto& infos = Require(infos_ptr);
+		const std::size_t count = infos.size();
 
-		if (converters[info_a.index].size() < info_b.index + 1)
-			converters[info_a.index].resize(info_b.index + 1, nullptr);
+		if (perfect_names.read().slots.size() != count)
+			BuildPerfectNameTable();
 
-		converters[info_a.index][info_b.index] = converter_ab;
+		const PerfectNameTable& name_table = perfect_names.read();
 
-		return true;
-	}
+		SnapshotHeader header;
+		OS::Vector<SnapshotType> types;
+		OS::Vector<u32> bases;
+		OS::Vector<u32> slots;
+		OS::Vector<wchar_t> names;
 
-	bool IsConvertibleTo(const Information& info_a, const Information& info_b)
-	{
-		const auto& converters = Require(converters_ptr);
-		return Valid(info_a.index) && Valid(info_b.index) && info_b.index < Index(converters[info_a.index].size()) && converters[info_a.index][info_b.index];
-	}
+		// Replaying the snapshot would hand retired indices out again
+		if (std::find(retired_types.begin(), retired_types.end(), true) != retired_types.end())
+			return false;
 
-	Converter GetConverter(const Information& info_a, const Information& info_b)
-	{
-		Program::Assert(IsConvertibleTo(info_a, info_b), "Cannot convert from A to B!");
-		return Require(converters_ptr)[info_a.index][info_b.index];
-	}
+		header.fingerprint = OS::ExecutableFingerprint();
 
-	bool AddInheritance(Information& derived_info, const OS::Vector<Index>& directly_inherited)
-	{
-		if (directly_inherited.empty())
-			return true;
+		if (header.fingerprint == 0)
+			return false;
 
-		for (const Index parent : directly_inherited)
+		types.reserve(count);
+
+		for (std::size_t type = 0; type < count; ++type)
 		{
-			if (!Valid(parent))
-				return false;
+			const Information& info = infos[type];
+			SnapshotType& entry = types.emplace_back();
 
-			if (parent == derived_info.index)
-				continue;
+			entry.alignment = info.alignment;
+			entry.size = info.size;
+			entry.id = info.id;
+			entry.name_offset = u32(names.size());
+			entry.name_length = u32(info.name.size());
+			entry.base_offset = u32(bases.size());
+
+			names.insert(names.end(), info.name.begin(), info.name.end());
+
+			if (type < direct_bases.size())
+			{
+				for (const Index base : direct_bases[type])
+					bases.push_back(u32(base));
+			}
+
+			entry.base_count = u32(bases.size()) - entry.base_offset;
+		}
 
-			if (std::size_t(parent) >= derived_info.bases.size())
-				derived_info.bases.resize(parent + 1);
+		if (name_table.slots.size() == count)
+		{
+			for (const Information* info : name_table.slots)
+				slots.push_back(u32(info->index));
+		}
 
-			derived_info.bases[parent] = true;
-			++derived_info.num_bases;
+		header.type_count = u32(count);
+		header.name_length = u32(names.size());
+		header.base_count = u32(bases.size());
+		header.bucket_count = slots.empty() ? 0 : u32(name_table.displacements.size());
 
-			const Information& parent_info = *GetType(parent);
-			OS::Vector<Index> parent_inherited;
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
 
-			parent_inherited.reserve(parent_info.num_bases);
+		if (!file)
+			return false;
 
-			for (std::size_t parent_base_index = 0; parent_info.num_bases > 0 && parent_base_index < parent_info.bases.size(); ++parent_base_index)
-			{
-				if (parent_info.bases[parent_base_index])
-					parent_inherited.push_back(Index(parent_base_index));
-			}
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		WriteSnapshotArray(file, types);
+		WriteSnapshotArray(file, bases);
 
-			if (!AddInheritance(derived_info, parent_inherited))
-				return false;
+		if (!slots.empty())
+		{
+			WriteSnapshotArray(file, name_table.displacements);
+			WriteSnapshotArray(file, slots);
 		}
 
-		return true;
-	}
+		WriteSnapshotArray(file, names);
 
-	bool AddConstructor(const Information& info, const Constructor constructor, const FunctionSignature signature)
-	{
-		auto [iterator, success] = Require(constructors_ptr)[info.index].try_emplace(signature, constructor);
-		return success;
+		return bool(file);
 	}
 
-	Constructor GetConstructor(const Information& info, const FunctionSignature signature)
+	bool LoadSnapshot(const char* path)
 	{
-		auto& constructors = Require(constructors_ptr);
+		// Names registered from a snapshot point into its mapping, so every mapping lives until shutdown
+		static OS::Vector<OS::MappedFile> mapped_snapshots;
 
-		Program::Assert(constructors[info.index].contains(signature), "No constructor with the specified signature!");
-		return constructors[info.index][signature];
-	}
+		const std::lock_guard lock(RegistrationMutex());
 
-	bool AddDestructor(const Information& info, const Destructor destructor)
-	{
-		Require(destructors_ptr)[info.index] = destructor;
-		return true;
-	}
+		RequireMutable();
 
-	Destructor GetDestructor(const Information& info)
-	{
-		const auto& destructors = Require(destructors_ptr);
+		OS::MappedFile file(path);
 
-		Program::Assert(destructors[info.index], "No destructor specified!");
-		return destructors[info.index];
-	}
+		if (file.size() < sizeof(SnapshotHeader))
+			return false;
 
-	bool AddAssigner(const Information& info, const Assigner assigner, const FunctionSignature signature)
-	{
-		auto [iterator, success] = Require(assigners_ptr)[info.index].try_emplace(signature, assigner);
-		return success;
-	}
+		SnapshotHeader header;
+		std::memcpy(&header, file.data(), sizeof(header));
 
-	Assigner GetAssigner(const Information& info, const FunctionSignature signature)
-	{
-		auto& assigners = Require(assigners_ptr);
+		const u64 fingerprint = OS::ExecutableFingerprint();
 
-		Program::Assert(assigners[info.index].contains(signature), "No assigner with the specified signature!");
-		return assigners[info.index][signature];
-	}
+		if (header.magic != kSnapshotMagic || header.version != kSnapshotVersion || header.wchar_size != sizeof(wchar_t)
+			|| fingerprint == 0 || header.fingerprint != fingerprint)
+		{
+			Program::Log::Std(L"Meta") << L"Snapshot does not match this build, registering from scratch" << std::endl;
+			return false;
+		}
 
-	bool AddUnaryOp(const Information& info, const UnaryOperator unary_operator, const UnaryOperation type, const FunctionSignature signature)
-	{
-		auto& unary_ops = Require(unary_ops_ptr);
+		const std::size_t slot_count = header.bucket_count > 0 ? header.type_count : 0;
+		const std::size_t types_offset = sizeof(SnapshotHeader);
+		const std::size_t bases_offset = types_offset + std::size_t(header.type_count) * sizeof(SnapshotType);
+		const std::size_t displacements_offset = bases_offset + std::size_t(header.base_count) * sizeof(u32);
+		const std::size_t slots_offset = displacements_offset + std::size_t(header.bucket_count) * sizeof(u32);
+		const std::size_t names_offset = slots_offset + slot_count * sizeof(u32);
 
-		if (unary_ops[info.index].size() < std::size_t(type) + 1)
-			unary_ops[info.index].resize(std::size_t(type) + 1);
+		if (file.size() != names_offset + std::size_t(header.name_length) * sizeof(wchar_t))
+			return false;
 
-		auto [iterator, success] = unary_ops[info.index][std::size_t(type)].try_emplace(signature, unary_operator);
-		return success;
-	}
+		const auto* types = reinterpret_cast<const SnapshotType*>(file.data() + types_offset);
+		const auto* bases = reinterpret_cast<const u32*>(file.data() + bases_offset);
+		const auto* displacements = reinterpret_cast<const u32*>(file.data() + displacements_offset);
+		const auto* slots = reinterpret_cast<const u32*>(file.data() + slots_offset);
+		const auto* names = reinterpret_cast<const wchar_t*>(file.data() + names_offset);
 
-	bool AddBinaryOp(const Information& info, const BinaryOperator binary_operator, const BinaryOperation type, const FunctionSignature signature)
-	{
-		auto& binary_ops = Require(binary_ops_ptr);
+		const auto& infos = Require(infos_ptr);
+		const std::size_t existing = infos.size();
 
-		if (binary_ops[info.index].size() < std::size_t(type) + 1)
-			binary_ops[info.index].resize(std::size_t(type) + 1);
+		// Validate everything before registering anything, so a bad snapshot leaves the registry untouched
+		for (std::size_t type = 0; type < header.type_count; ++type)
+		{
+			const SnapshotType& entry = types[type];
 
-		auto [iterator, success] = binary_ops[info.index][std::size_t(type)].try_emplace(signature, binary_operator);
-		return success;
-	}
+			if (std::size_t(entry.name_offset) + entry.name_length > header.name_length
+				|| std::size_t(entry.base_offset) + entry.base_count > header.base_count)
+				return false;
 
-	void DumpInfo()
-	{
-		static constexpr auto kLabel = L"Meta";
+			for (u32 base = 0; base < entry.base_count; ++base)
+			{
+				if (bases[entry.base_offset + base] >= header.type_count)
+					return false;
+			}
 
-		Program::Log::Std(kLabel) << L"-------------------- Meta --------------------" << std::endl;
-		Program::Log::Std(kLabel) << L"~~~~~ Type List ~~~~" << std::endl;
+			if (type < existing)
+			{
+				const Information& info = infos[type];
+				const Program::Name name(names + entry.name_offset, entry.name_length);
 
-		Index digits = 0;
-		Index type_counter_copy = type_counter;
+				if (info.name != name || info.alignment != entry.alignment || info.size != entry.size)
+					return false;
+			}
+		}
 
-		while (type_counter_copy > 0)
+		for (std::size_t slot = 0; slot < slot_count; ++slot)
 		{
-			type_counter_copy /= 10;
-			++digits;
+			if (slots[slot] >= header.type_count)
+				return false;
 		}
 
-		for (const auto& infos = Require(infos_ptr); const Information& info : infos)
+		if (existing > header.type_count)
+			return false;
+
+		for (std::size_t type = existing; type < header.type_count; ++type)
 		{
-			Program::Log::Std(kLabel)
-				<< L"Type ID: " << std::setfill(L'0') << std::setw(int(digits)) << info.index
-				<< L" | Name: " << info.name;
+			const SnapshotType& entry = types[type];
+			const Information& info = Register(Program::Name(names + entry.name_offset, entry.name_length), entry.alignment, entry.size, entry.id);
 
-			if (info.num_bases > 0)
-			{
-				Program::Log::Std() << L" | Bases: ";
+			Program::Assert(std::size_t(info.index) == type, "Snapshot type registered out of order!");
+		}
 
-				Index base_count = 0;
+		snapshot_bases.resize(header.type_count, false);
 
-				for (std::size_t base_index = 0; base_index < info.bases.size(); ++base_index)
-				{
-					if (info.bases[base_index])
-					{
-						Program::Log::Std() << infos[base_index].name << L" ";
+		for (std::size_t type = 0; type < header.type_count; ++type)
+		{
+			const SnapshotType& entry = types[type];
 
-						if (base_count < Index(info.num_bases - 1))
-							Program::Log::Std() << L", ";
+			if (entry.base_count > 0)
+			{
+				if (direct_bases.size() <= type)
+					direct_bases.resize(type + 1);
 
-						++base_count;
-					}
-				}
+				direct_bases[type].assign(bases + entry.base_offset, bases + entry.base_offset + entry.base_count);
+				hierarchy_stale.store(true, std::memory_order_release);
 			}
 
-			std::cout << std::endl;
+			snapshot_bases[type] = true;
 		}
 
-		Program::Log::Std(kLabel) << L"~~~~~ Type Stats ~~~~~" << std::endl;
-		Program::Log::Std(kLabel) << L"Number of types: " << type_counter << std::endl;
+		if (slot_count > 0)
+		{
+			perfect_names.update([&](PerfectNameTable& table)
+			{
+				table.displacements.assign(displacements, displacements + header.bucket_count);
+				table.slots.resize(slot_count);
+
+				for (std::size_t slot = 0; slot < slot_count; ++slot)
+					table.slots[slot] = &infos[slots[slot]];
+
+				return true;
+			});
+		}
 
-		if (std::size_t(type_counter) > kPreallocationAmount)
-			Program::Log::Std(kLabel) << L"Recommendation: Set kPreallocationAmount to " << type_counter << std::endl;
+		mapped_snapshots.push_back(std::move(file));
+
+		return true;
 	}
 
 	View::View(void* ptr, const Information& info, const Qualifier qualifier_flags)
 		: data()
+		, id(ptr ? info.id : kInvalidTypeId)
 		, type(info.index)
 		, qualifiers(qualifier_flags)
 	{
@@ -678,14 +5028,8 @@ namespace Meta
 
 	bool View::is(const Information& info, const Qualifier qualifier_flags) const
 	{
-		if (qualifier_flags != qualifiers && !is_in_place_primitive())
-		{
-			const bool can_allow_const = ((qualifiers & qualifier_flags) & kQualifier_Constant)  || !(qualifiers & kQualifier_Constant);
-			const bool can_allow_ref   = ((qualifiers & qualifier_flags) & kQualifier_Reference) || ((qualifier_flags & kQualifier_Temporary) && (qualifiers & kQualifier_Reference));
-
-			if (!(can_allow_const && can_allow_ref))
-				return false;
-		}
+		if (!is_in_place_primitive() && !QualifiersBind(qualifiers, qualifier_flags))
+			return false;
 
 		if (is_in_place_primitive())
 			return get_type() == info.index;
@@ -696,8 +5040,7 @@ namespace Meta
 		if (type == info.index)
 			return true;
 
-		const Information* my_info = GetType(type);
-		return std::size_t(info.index) < my_info->bases.size() && my_info->bases[info.index];
+		return InheritsFrom(type, info.index);
 	}
 
 	bool View::is_castable_to(const Information& info) const
@@ -718,6 +5061,31 @@ namespace Meta
 		return *reinterpret_cast<void**>(const_cast<u8*>(&data[0]));
 	}
 
+	View View::cast_to(const Information& info) const
+	{
+		Program::Assert(valid(), "No memory to cast!");
+
+		const Index from = get_type();
+
+		Program::Assert(Valid(info.index), "Cannot cast to this type!");
+
+		// A direct caster is called as it is, without looking for a path
+		if (const Caster caster = DirectCaster(from, info.index)) [[likely]]
+			return caster(*this);
+
+		return WithCastPath(from, info.index, [&](const OS::Vector<Caster>& path)
+		{
+			Program::Assert(!path.empty(), "Cannot cast to this type!");
+
+			View view = *this;
+
+			for (const Caster caster : path)
+				view = caster(view);
+
+			return view;
+		});
+	}
+
 	Caster View::get_caster(const Information& info_b) const
 	{
 		Program::Assert(valid(), "No memory to cast!");
@@ -726,13 +5094,18 @@ namespace Meta
 
 	bool AddSingleton(const Information& info, const View view)
 	{
-		Require(singletons_ptr)[info.index] = view;
-		return true;
+		const std::lock_guard lock(RegistrationMutex());
+
+		return Require(singletons_ptr)[info.index].update([&](View& singleton)
+		{
+			singleton = view;
+			return true;
+		});
 	}
 
 	View GetSingleton(const Information& info)
 	{
-		const View singleton = Require(singletons_ptr)[info.index];
+		const View singleton = Require(singletons_ptr)[info.index].read();
 
 		Program::Assert(singleton.valid() && singleton.is(info, kQualifier_Reference), "No singleton found!");
 		return singleton;
@@ -742,7 +5115,8 @@ namespace Meta
 		: view(other.view)
 		, index(other.index)
 	{
-		if (!view.is_in_place_primitive())
+		// Views wrapped by Handle(View) own nothing to count
+		if (!view.is_in_place_primitive() && index != Memory::kInvalidIndex)
 			Memory::get_allocator<Memory::Pool>(view.type)->ref(index);
 	}
 
@@ -784,7 +5158,8 @@ namespace Meta
 			view = other.view;
 			index = other.index;
 
-			Memory::get_allocator<Memory::Pool>(view.type)->ref(index);
+			if (!view.is_in_place_primitive() && index != Memory::kInvalidIndex)
+				Memory::get_allocator<Memory::Pool>(view.type)->ref(index);
 		}
 
 		return *this;
@@ -832,7 +5207,8 @@ namespace Meta
 
 	bool Handle::is_convertible_to(const Information& info) const
 	{
-		if (!valid())
+		// Views wrapped by Handle(View) convert just as well as owned objects
+		if (!view.valid())
 			return false;
 		return IsConvertibleTo(*GetType(view.get_type()), info);
 	}
@@ -852,14 +5228,30 @@ namespace Meta
 		invalidate();
 	}
 
-	Converter Handle::get_converter(const Information& info_b) const
+	Handle Handle::convert_to(const Information& info) const
 	{
-		Program::Assert(valid(), "No memory to convert!");
-		return GetConverter(*GetType(view.get_type()), info_b);
+		Program::Assert(view.valid(), "No memory to convert!");
+
+		const Index from = view.get_type();
+
+		Program::Assert(Valid(info.index), "Cannot convert to this type!");
+
+		// A direct converter is called as it is, without looking for a plan
+		if (const Converter converter = DirectConverter(from, info.index)) [[likely]]
+			return converter(view);
+
+		return WithConversionPlan(from, info.index, [&](const ConversionPlan& plan)
+		{
+			Program::Assert(plan.valid(), "Cannot convert to this type!");
+			return plan.execute(view);
+		});
 	}
 
 	Spandle::~Spandle()
 	{
+		if (handles || list.empty())
+			return;
+
 		Memory::get_allocator<Memory::Heap>(Info<Handle>().index)->free(list);
 	}
 
@@ -873,15 +5265,23 @@ namespace Meta
 	Handle& Spandle::operator[](const Memory::Index index)
 	{
 		Program::Assert(list.is_valid(index), "Out-of-bounds!");
-		auto* const result = static_cast<Handle* const>(Memory::get_allocator<Memory::Heap>(Info<Handle>().index)->get(index));
+
+		if (handles)
+			return handles[index];
+
+		auto* const result = static_cast<Handle* const>(Memory::get_allocator<Memory::Heap>(Info<Handle>().index)->get(list.start + index));
 		Program::Assert(result, "Could not create Handle!");
 		return *result;
 	}
 
-	Handle Spandle::operator[](const Memory::Index index) const
+	const Handle& Spandle::operator[](const Memory::Index index) const
 	{
 		Program::Assert(list.is_valid(index), "Out-of-bounds!");
-		const auto* const result = static_cast<const Handle* const>(Memory::get_allocator<Memory::Heap>(Info<Handle>().index)->get(index));
+
+		if (handles)
+			return handles[index];
+
+		const auto* const result = static_cast<const Handle* const>(Memory::get_allocator<Memory::Heap>(Info<Handle>().index)->get(list.start + index));
 		Program::Assert(result, "Could not create Handle!");
 		return *result;
 	}
@@ -914,4 +5314,49 @@ namespace Meta
 
 		return { reinterpret_cast<const char*>(&memory), size() * sizeof(Parameter) };
 	}
+
+	SignatureId Spandle::get_signature_id() const
+	{
+		SignatureId id = kEmptySignature;
+
+		for (Memory::Index i = 0; i < Memory::Index(size()) && id != kInvalidSignature; ++i)
+		{
+			const View view = (*this)[i].view;
+			id = ExtendSignature(id, { view.get_type(), view.qualifiers });
+		}
+
+		return id;
+	}
+
+	SignatureId Spandle::get_argument_signature_id() const
+	{
+		const auto parameter_of = [](const View& view) -> Parameter
+		{
+			return { view.get_type(), view.is_in_place_primitive() ? kQualifier_InPlace : view.qualifiers };
+		};
+
+		SignatureId id = kEmptySignature;
+
+		for (Memory::Index i = 0; i < Memory::Index(size()); ++i)
+		{
+			const View& view = (*this)[i].view;
+
+			if (const SignatureId next = ExtendSignature(id, parameter_of(view)); next != kInvalidSignature) [[likely]]
+			{
+				id = next;
+				continue;
+			}
+
+			// First call with these argument types
+			OS::Vector<Parameter> parameters;
+			parameters.reserve(size());
+
+			for (Memory::Index j = 0; j < Memory::Index(size()); ++j)
+				parameters.push_back(parameter_of((*this)[j].view));
+
+			return InternSignature({ reinterpret_cast<const char*>(parameters.data()), parameters.size() * sizeof(Parameter) });
+		}
+
+		return id;
+	}
 }
@@ -25,15 +25,25 @@
 
 #include <array>
 #include <cassert>
+#include <cstddef>
 #include <functional>
+#include <optional>
+#include <span>
 #include <string_view>
 #include <type_traits>
 #include <utility>
 
 #include "Math.hpp"
+#include "MetaConfig.hpp"
 #include "OS.hpp"
 #include "Program.hpp"
 
+#if defined(_MSC_VER) && !defined(__clang__)
+#define META_FUNCTION_SIGNATURE __FUNCSIG__
+#else
+#define META_FUNCTION_SIGNATURE __PRETTY_FUNCTION__
+#endif
+
 namespace Meta
 {
 	// Intentionally not implemented by default to force user to define nameof() function for a type via NAMEOF_DEF
@@ -65,6 +75,34 @@ namespace Meta
 	using Index = i32;
 	constexpr Index kInvalidType = -1;
 
+	// Stable across translation units built by the same compiler, unlike Index which depends on registration order
+	using TypeId = u64;
+	constexpr TypeId kInvalidTypeId = 0;
+
+	// Shared library loaded through LoadModule()
+	using ModuleId = u32;
+	constexpr ModuleId kInvalidModule = 0;
+
+	// FNV-1a over the compiler's signature string for this instantiation, which spells out T
+	template<typename T>
+	constexpr TypeId TypeIdOf()
+	{
+		constexpr std::string_view signature = META_FUNCTION_SIGNATURE;
+
+		TypeId hash = 0xCBF29CE484222325ull;
+
+		for (const char character : signature)
+		{
+			hash ^= TypeId(u8(character));
+			hash *= 0x100000001B3ull;
+		}
+
+		return hash == kInvalidTypeId ? hash + 1 : hash;
+	}
+
+	template<typename T>
+	constexpr TypeId kTypeId = TypeIdOf<std::remove_pointer_t<std::remove_cvref_t<T>>>();
+
 	using Qualifier = u8;
 	constexpr u8 kQualifier_Temporary = 0b0001;
 	constexpr u8 kQualifier_Constant  = 0b0010;
@@ -79,25 +117,40 @@ namespace Meta
 		| (u8(std::is_lvalue_reference_v<T>) << u8(3))
 		);
 
+	// Every combination of the four qualifier bits, for tables indexed by them
+	constexpr std::size_t kQualifierCombinations = 16;
+
+	// Whether a value with the first qualifiers can be read as the second, the rule View::is() applies
+	constexpr bool QualifiersBind(const Qualifier have, const Qualifier want)
+	{
+		if (have == want)
+			return true;
+
+		const bool can_allow_const = ((have & want) & kQualifier_Constant)  || !(have & kQualifier_Constant);
+		const bool can_allow_ref   = ((have & want) & kQualifier_Reference) || ((want & kQualifier_Temporary) && (have & kQualifier_Reference));
+
+		return can_allow_const && can_allow_ref;
+	}
+
 	struct Information
 	{
 		Index index = kInvalidType;
 		Program::Name name;
 		std::size_t alignment = 0;
 		std::size_t size = 0;
-
-		OS::BitVector bases;
-		std::size_t num_bases = 0;
+		TypeId id = kInvalidTypeId;
 	};
 
-	std::pair<OS::Vector<Information>*, Index> Register(const Program::Name name, const std::size_t alignment, const std::size_t size);
+	// Safe to call from any thread. The returned reference stays valid for the lifetime of the program.
+	// Types registered only by name at runtime have no TypeId.
+	const Information& Register(const Program::Name name, const std::size_t alignment, const std::size_t size, const TypeId id = kInvalidTypeId);
 
 	template<typename T>
 	const Information& Info()
 	{
 		using Type = std::remove_pointer_t<std::remove_cvref_t<T>>;
-		static const auto infos_pair = Register(nameof<Type>(), alignof(Type), sizeof(Type));
-		return (*infos_pair.first)[infos_pair.second];
+		static const Information& info = Register(nameof<Type>(), alignof(Type), sizeof(Type), kTypeId<Type>);
+		return info;
 	}
 
 	Index Find(Program::Name name);
@@ -108,6 +161,10 @@ namespace Meta
 		return Find(nameof<T>());
 	}
 
+	// Builds a minimal perfect hash over every name registered so far, which Find() probes before the regular
+	// index. Names registered afterwards are still found through the regular index. Freeze() calls this too.
+	bool BuildPerfectNameTable();
+
 	const Information* GetType(Index type);
 
 	template<typename... Args>
@@ -130,6 +187,29 @@ namespace Meta
 
 	void DumpInfo();
 
+	// Compiles everything registered so far into flat, read-only tables that lookups use from then on.
+	// Registering types, constructors, destructors, assigners or inheritance is an error until Thaw() is called.
+	// Thaw() may run alongside readers: the tables they may still be using, and any Information pointers GetType()
+	// handed out while frozen, stay valid until shutdown, so each Freeze() keeps one more copy of the registry.
+	void Freeze();
+	void Thaw();
+	bool IsFrozen();
+
+	// Writes the names, sizes, bases and name table of everything registered so far to a binary file keyed by the
+	// executable's fingerprint.
+	bool SaveSnapshot(const char* path);
+
+	// Maps a snapshot written by this same build and registers its types, bases and name table without rebuilding
+	// them, so static initializers only have to bind function pointers. Returns false and changes nothing if the
+	// snapshot is missing, malformed or from another build. Set kSnapshotPath to load one before any META_TYPE runs.
+	bool LoadSnapshot(const char* path);
+
+	class Handle;
+	class Spandle;
+	struct Field;
+	enum UnaryOperation : u8;
+	enum BinaryOperation : u8;
+
 	class View
 	{
 	public:
@@ -179,6 +259,7 @@ namespace Meta
 		View& operator=(T&& value)
 		{
 			type = -Info<T>().index + kByValue_u8;
+			id = kTypeId<T>;
 			qualifiers = QualifiersOf<T&&>;
 			*static_cast<std::remove_cvref_t<T>*>(static_cast<void*>(&data[0])) = value;
 			return *this;
@@ -192,9 +273,32 @@ namespace Meta
 		template<typename T>
 		[[nodiscard]] bool is() const
 		{
+			if constexpr (kCompileTimeTypeIds)
+			{
+				// Only base classes and differing qualifiers need the registry. In-place primitives ignore qualifiers.
+				if (id == kTypeId<T> && (qualifiers == QualifiersOf<T> || type < kInvalidType)) [[likely]]
+					return true;
+			}
+
 			return is(Info<T>(), QualifiersOf<T>);
 		}
 
+		[[nodiscard]] Qualifier get_qualifiers() const { return qualifiers; }
+
+		// The object as a T, or null if it is neither a T nor derived from one. Qualifiers are left to the caller, and
+		// in-place primitives point into this View.
+		template<typename T> requires (std::is_same_v<T, std::remove_cvref_t<T>>)
+		[[nodiscard]] T* object() const
+		{
+			if constexpr (kCompileTimeTypeIds)
+			{
+				if (id == kTypeId<T>) [[likely]]
+					return static_cast<T*>(internal());
+			}
+
+			return is(Info<T>(), qualifiers) ? static_cast<T*>(internal()) : nullptr;
+		}
+
 		template<typename T>
 		std::remove_cvref_t<T>* raw() const
 		{
@@ -229,11 +333,13 @@ namespace Meta
 			return is_castable_to(Info<U>());
 		}
 
+		// Through a direct caster, or else the shortest chain of registered ones
+		[[nodiscard]] View cast_to(const Information& info) const;
+
 		template<typename U>
 		[[nodiscard]] View cast_to() const
 		{
-			Program::Assert(is_castable_to<U>(), "Cannot cast to this type!");
-			return get_caster(Info<U>())(*this);
+			return cast_to(Info<U>());
 		}
 
 	private:
@@ -265,6 +371,7 @@ namespace Meta
 			, sizeof(bool)
 			, sizeof(void*)
 		})] = { 0 };
+		TypeId id = kInvalidTypeId; // Only set when the View points at something
 		Index type = kInvalidType;
 		Qualifier qualifiers = kQualifier_Temporary;
 
@@ -278,6 +385,16 @@ namespace Meta
 
 		template<typename T> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>>)
 		friend Caster FromCaster();
+
+		friend bool UnloadModule(const ModuleId module); // NOLINT(*-avoid-const-params-in-decls)
+		friend Handle Apply(const UnaryOperation operation, const View operand); // NOLINT(*-avoid-const-params-in-decls)
+		friend Handle Apply(const BinaryOperation operation, const View lhs, const View rhs); // NOLINT(*-avoid-const-params-in-decls)
+		friend void ApplyInto(const UnaryOperation operation, const View destination, const View operand); // NOLINT(*-avoid-const-params-in-decls)
+		friend void ApplyInto(const BinaryOperation operation, const View destination, const View lhs, const View rhs); // NOLINT(*-avoid-const-params-in-decls)
+		friend void InvokeInto(const Information& info, const Program::Name name, const View destination, const View object, const Spandle& arguments); // NOLINT(*-avoid-const-params-in-decls)
+		friend void ApplyBatch(const BinaryOperation operation, const Information& info, const void* lhs, const void* rhs, void* out, const std::size_t count); // NOLINT(*-avoid-const-params-in-decls)
+		friend View FieldOf(const View object, const Field& field); // NOLINT(*-avoid-const-params-in-decls)
+		friend class Expression;
 	};
 
 	bool AddSingleton(const Information& info, const View view); // NOLINT(*-avoid-const-params-in-decls)
@@ -329,6 +446,11 @@ namespace Meta
 	using ParameterArray = std::array<Parameter, kMaximumParameters>;
 	using FunctionSignature = std::string_view;
 
+	// Dense ID of an interned FunctionSignature. Registration interns; dispatch only compares IDs.
+	using SignatureId = u32;
+	constexpr SignatureId kEmptySignature   = 0;
+	constexpr SignatureId kInvalidSignature = ~SignatureId(0);
+
 	class Handle
 	{
 	public:
@@ -359,10 +481,15 @@ namespace Meta
 		Handle(T&& value) // NOLINT(*-explicit-constructor)
 			: Handle()
 		{
+			using U = std::remove_cvref_t<T>;
+
+			// Rvalues move through the T&& constructor, lvalues and const rvalues copy through the const T& one
 			if constexpr (kIsPrimitive<T>)
 				view = value;
+			else if constexpr (std::is_lvalue_reference_v<T> || std::is_const_v<std::remove_reference_t<T>>)
+				*this = Handle(Info<U>(), Spandle(static_cast<const U*>(&value)));
 			else
-				*this = Handle(Info<T>(), Spandle(&value));
+				*this = Handle(Info<U>(), Spandle(Handle(View(&value, Info<U>(), QualifiersOf<U&&>))));
 		}
 
 		template<typename T>
@@ -392,7 +519,7 @@ namespace Meta
 		template<typename T>
 		[[nodiscard]] bool is() const
 		{
-			return is(Meta::Info<T>(), QualifiersOf<std::remove_pointer_t<T>>);
+			return view.is<std::remove_pointer_t<T>>();
 		}
 
 		template<typename T>
@@ -417,21 +544,20 @@ namespace Meta
 			return is_convertible_to(Info<U>());
 		}
 
+		[[nodiscard]] Handle convert_to(const Information& info) const;
+
 		template<typename U>
 		[[nodiscard]] Handle convert_to() const
 		{
-			return get_converter(Info<U>())(view);
+			return convert_to(Info<U>());
 		}
 
 	private:
-		using Converter = Handle (*)(const View);
-
 		View view = View();
 		Memory::Index index = Memory::kInvalidIndex;
 
 		void invalidate();
 		void destroy();
-		[[nodiscard]] Converter get_converter(const Information& info_b) const;
 
 		friend Spandle;
 	};
@@ -471,18 +597,70 @@ namespace Meta
 		Spandle& operator=(Spandle&&) = default;
 
 		Handle& operator[](Memory::Index index);
-		Handle  operator[](Memory::Index index) const;
+		const Handle& operator[](Memory::Index index) const;
 
 		[[nodiscard]] size_t size() const;
 		[[nodiscard]] bool empty() const;
 
 		[[nodiscard]] FunctionSignature get_function_signature(ParameterArray& memory) const;
+		// Built one parameter at a time without scratch memory, kInvalidSignature if nothing takes these arguments
+		[[nodiscard]] SignatureId get_signature_id() const;
+		// Interned on first sight for the overload resolver, with in-place primitives marked since they bind to any qualifiers
+		[[nodiscard]] SignatureId get_argument_signature_id() const;
 
 	private:
 		Memory::Range list;
+		Handle* handles = nullptr; // Storage owned by an ArgPack instead of the Heap
 		void allocate(const size_t num_handles); // NOLINT(*-avoid-const-params-in-decls)
+
+		template<std::size_t Capacity>
+		friend class ArgPack;
 	};
 
+	// Arguments held on the stack, so a call with lvalue and primitive arguments never touches the Pool or the Heap.
+	// Objects are referenced rather than copied, so they must outlive the pack, and the pack can't be copied or moved
+	// since its Spandle points into itself.
+	template<std::size_t Capacity>
+	class ArgPack : public Spandle
+	{
+	public:
+		template<typename... Args> requires (sizeof...(Args) <= Capacity)
+		explicit ArgPack(Args&&... args)
+			: storage{ Argument(std::forward<Args>(args))... }
+		{
+			list = { 0, Memory::Index(sizeof...(Args)) };
+			handles = storage.data();
+		}
+
+		ArgPack(const ArgPack&) = delete;
+		ArgPack(ArgPack&&) = delete;
+		~ArgPack() = default;
+
+		ArgPack& operator=(const ArgPack&) = delete;
+		ArgPack& operator=(ArgPack&&) = delete;
+
+	private:
+		std::array<Handle, Capacity> storage;
+
+		template<typename T>
+		static Handle Argument(T&& argument)
+		{
+			static_assert(kIsPrimitive<T> || std::is_pointer_v<std::remove_cvref_t<T>> || std::is_same_v<std::remove_cvref_t<T>, View> || std::is_lvalue_reference_v<T>, "Objects must be passed as lvalues, pointers or Views!");
+
+			if constexpr (kIsPrimitive<T>)
+				return Handle(std::remove_cvref_t<T>(argument));
+			else if constexpr (std::is_same_v<std::remove_cvref_t<T>, View>)
+				return Handle(argument);
+			else if constexpr (std::is_pointer_v<std::remove_cvref_t<T>>)
+				return Handle(View(argument));
+			else
+				return Handle(View(&argument));
+		}
+	};
+
+	template<typename... Args>
+	ArgPack(Args&&...) -> ArgPack<sizeof...(Args)>;
+
 	// -----------------------------------------------------------------------------------------------------------------
 	// Conversion
 	// -----------------------------------------------------------------------------------------------------------------
@@ -490,6 +668,10 @@ namespace Meta
 	using Caster = View (*)(const View);
 	using Converter = Handle (*)(const View);
 
+	// Constructs the converted value in the uninitialized storage the destination views, so a step in the middle of a
+	// ConversionPlan needs no Handle
+	using InPlaceConverter = void (*)(const View destination, const View source);
+
 	template<typename T> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>>)
 	Caster FromCaster()
 	{
@@ -516,6 +698,8 @@ namespace Meta
 		return AddCaster(Info<T>(), Info<U>(), kCasterOf<U>) && AddCaster(Info<U>(), Info<T>(), kCasterOf<T>);
 	}
 
+	// True for composed paths as well as direct casters. Paths are found breadth first on their first request and
+	// cached until the next registration.
 	bool IsCastableTo(const Information& info_a, const Information& info_b);
 
 	template<typename T, typename U> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>> && std::is_same_v<U, std::remove_pointer_t<std::remove_cvref_t<U>>>)
@@ -524,6 +708,7 @@ namespace Meta
 		return IsCastableTo(Info<T>(), Info<U>());
 	}
 
+	// Direct casters only, since a composed path is not one function. See CastTo().
 	Caster GetCaster(const Information& info_a, const Information& info_b);
 
 	template<typename T, typename U> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>> && std::is_same_v<U, std::remove_pointer_t<std::remove_cvref_t<U>>>)
@@ -532,6 +717,17 @@ namespace Meta
 		return GetCaster(Info<T>(), Info<U>());
 	}
 
+	View CastTo(const View view, const Information& info_b); // NOLINT(*-avoid-const-params-in-decls)
+
+	// Casters on the shortest path from A to B, 1 for a direct caster and 0 if there is no path
+	std::size_t CastPathLength(const Information& info_a, const Information& info_b);
+
+	template<typename T, typename U> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>> && std::is_same_v<U, std::remove_pointer_t<std::remove_cvref_t<U>>>)
+	std::size_t CastPathLength()
+	{
+		return CastPathLength(Info<T>(), Info<U>());
+	}
+
 	template<typename T, typename U> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>> && std::is_same_v<U, std::remove_pointer_t<std::remove_cvref_t<U>>>)
 	Converter FromConverter()
 	{
@@ -541,20 +737,31 @@ namespace Meta
 		};
 	}
 
+	template<typename T, typename U> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>> && std::is_same_v<U, std::remove_pointer_t<std::remove_cvref_t<U>>>)
+	InPlaceConverter FromInPlaceConverter()
+	{
+		return [](const View destination, const View view) -> void
+		{
+			new (destination.raw<T&>()) T(view.as<const U&>());
+		};
+	}
+
 	bool AddConverter(const Information& info_a, const Information& info_b, const Converter converter_ab); // NOLINT(*-avoid-const-params-in-decls)
+	bool AddConverter(const Information& info_a, const Information& info_b, const Converter converter_ab, const InPlaceConverter in_place_ab); // NOLINT(*-avoid-const-params-in-decls)
 
 	template<typename T, typename U> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>> && std::is_same_v<U, std::remove_pointer_t<std::remove_cvref_t<U>>>)
 	bool AddConverter()
 	{
-		return AddConverter(Info<T>(), Info<U>(), FromConverter<T, U>());
+		return AddConverter(Info<T>(), Info<U>(), FromConverter<U, T>(), FromInPlaceConverter<U, T>());
 	}
 
 	template<typename T, typename U> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>> && std::is_same_v<U, std::remove_pointer_t<std::remove_cvref_t<U>>>)
 	bool AddTwoWayConversion()
 	{
-		return AddConverter(Info<T>(), Info<U>(), FromConverter<T, U>()) && AddConverter(Info<U>(), Info<T>(), FromConverter<U, T>());
+		return AddConverter<T, U>() && AddConverter<U, T>();
 	}
 
+	// True for chains of converters as well as direct ones. See PlanConversion().
 	bool IsConvertibleTo(const Information& info_a, const Information& info_b);
 
 	template<typename T, typename U> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>> && std::is_same_v<U, std::remove_pointer_t<std::remove_cvref_t<U>>>)
@@ -563,6 +770,7 @@ namespace Meta
 		return IsConvertibleTo(Info<T>(), Info<U>());
 	}
 
+	// Direct converters only, since a chain is not one function. See ConvertTo().
 	Converter GetConverter(const Information& info_a, const Information& info_b);
 
 	template<typename T, typename U> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>> && std::is_same_v<U, std::remove_pointer_t<std::remove_cvref_t<U>>>)
@@ -571,6 +779,9 @@ namespace Meta
 		return GetConverter(Info<T>(), Info<U>());
 	}
 
+	// Through a direct converter, or else the memoized plan
+	Handle ConvertTo(const View view, const Information& info_b); // NOLINT(*-avoid-const-params-in-decls)
+
 	// -----------------------------------------------------------------------------------------------------------------
 	// Inheritance
 	// -----------------------------------------------------------------------------------------------------------------
@@ -610,11 +821,88 @@ namespace Meta
 		return signature;
 	}
 
+	// Returns the signature's ID, interning it on first use
+	SignatureId InternSignature(const FunctionSignature signature); // NOLINT(*-avoid-const-params-in-decls)
+	// Never interns, so kInvalidSignature means no function was ever registered with the signature
+	SignatureId FindSignature(const FunctionSignature signature); // NOLINT(*-avoid-const-params-in-decls)
+	// The prefix's signature with one more parameter, kInvalidSignature if that was never interned
+	SignatureId ExtendSignature(const SignatureId prefix, const Parameter parameter); // NOLINT(*-avoid-const-params-in-decls)
+	FunctionSignature GetSignature(const SignatureId signature); // NOLINT(*-avoid-const-params-in-decls)
+
+	template<typename... Args>
+	SignatureId SignatureIdOf()
+	{
+		static const SignatureId signature = InternSignature(FromParameterList<Args...>());
+		return signature;
+	}
+
+	// Moves on whenever a constructor, destructor, assigner or operator could resolve differently
+	u64 RegistryGeneration();
+
+	// Remembers the last few (type, signature) resolutions of one call site. Everything is dropped at once when the
+	// registry generation moves on, and replaced round-robin when full. Not synchronised: keep one per call site per
+	// thread, or behind whatever already guards the site.
+	template<typename Function, std::size_t Ways = kDispatchCacheWays>
+	class DispatchCache
+	{
+	public:
+		template<typename Resolve>
+		Function get(const Index type, const SignatureId signature, Resolve&& resolve)
+		{
+			if (const u64 current = RegistryGeneration(); current != generation) [[unlikely]]
+			{
+				keys.fill(Key());
+				generation = current;
+			}
+
+			for (std::size_t way = 0; way < Ways; ++way)
+			{
+				if (keys[way].type == type && keys[way].signature == signature)
+					return functions[way];
+			}
+
+			const Function function = resolve();
+
+			keys[next] = { type, signature };
+			functions[next] = function;
+			next = (next + 1) % Ways;
+
+			return function;
+		}
+
+	private:
+		struct Key
+		{
+			Index type = kInvalidType;
+			SignatureId signature = kInvalidSignature;
+		};
+
+		std::array<Key, Ways> keys = {};
+		std::array<Function, Ways> functions = {};
+		u64 generation = 0;
+		std::size_t next = 0;
+	};
+
 	// -----------------------------------------------------------------------------------------------------------------
 	// Methods
 	// -----------------------------------------------------------------------------------------------------------------
 
 	using Method = Handle (*)(const View, const Spandle&);
+	using MethodInto = void (*)(const View destination, const View object, const Spandle& parameters);
+
+	// The Into forms of methods, functions, members and operators assign their result to a live value the destination
+	// references, so a result that isn't primitive never takes a slot in its type's Pool. The destination must be a
+	// mutable reference of exactly the result's type and may alias an argument.
+	template<typename R>
+	void StoreResult(const View destination, R&& result)
+	{
+		using Type = std::remove_cvref_t<R>;
+
+		Type* target = destination.object<Type>();
+
+		Program::Assert(target && (destination.get_qualifiers() & (kQualifier_Temporary | kQualifier_Constant | kQualifier_Reference)) == kQualifier_Reference, "Not a writable destination of the result's type!");
+		*target = std::forward<R>(result);
+	}
 
 	template<typename U>
 	Handle MapTo(const Handle& handle)
@@ -636,133 +924,160 @@ namespace Meta
 		return {};
 	}
 
-	template<typename T, auto MethodPtr, typename Return, bool IsConst, typename Tuple, std::size_t... Index> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>>)
-	Method FromMethodImpl(std::index_sequence<Index...>)
+	template<typename Arg>
+	using ArgumentBinder = Arg (*)(const Handle& argument, Handle& converted);
+
+	// Arguments that don't bind as they are go through MapTo(), which keeps what it made alive in converted
+	template<typename Arg>
+	Arg BindConverted(const Handle& argument, Handle& converted)
 	{
-		return [](const View view, const Spandle& parameters) -> Handle
+		converted = MapTo<Arg>(argument);
+		// ReSharper is wrong
+		// ReSharper disable once CppRedundantTemplateKeyword
+		return converted.template as<Arg>();
+	}
+
+	// Only picked for qualifiers that bind, so all that is left to check is the type
+	template<typename Arg>
+	Arg BindDirect(const Handle& argument, Handle& converted)
+	{
+		const View view = argument.peek();
+
+		if (auto* object = view.object<std::remove_cvref_t<Arg>>()) [[likely]]
+			return static_cast<Arg>(*object);
+
+		return BindConverted<Arg>(argument, converted);
+	}
+
+	template<typename Arg>
+	constexpr std::array<ArgumentBinder<Arg>, kQualifierCombinations> ArgumentBinders()
+	{
+		std::array<ArgumentBinder<Arg>, kQualifierCombinations> binders = {};
+
+		for (std::size_t qualifiers = 0; qualifiers < kQualifierCombinations; ++qualifiers)
+			binders[qualifiers] = QualifiersBind(Qualifier(qualifiers), QualifiersOf<Arg>) ? &BindDirect<Arg> : &BindConverted<Arg>;
+
+		return binders;
+	}
+
+	// One indexed jump on the argument's qualifiers instead of a chain of View::is() checks
+	template<typename Arg>
+	Arg BindArgument(const Handle& argument, Handle& converted)
+	{
+		if constexpr (std::is_pointer_v<Arg>)
+			return BindConverted<Arg>(argument, converted);
+		else
 		{
-			Handle result;
+			static constexpr std::array<ArgumentBinder<Arg>, kQualifierCombinations> kBinders = ArgumentBinders<Arg>();
+			return kBinders[argument.peek().get_qualifiers() & (kQualifierCombinations - 1)](argument, converted);
+		}
+	}
 
-			if constexpr (sizeof...(Index) > 0)
+	// Returns the result, or stores it and returns nothing when given a destination
+	template<auto MethodPtr, typename Return, typename Tuple, typename Receiver, std::size_t... Index>
+	Handle CallMethod(Receiver& object, const Spandle& parameters, const View* destination)
+	{
+		Program::Assert(parameters.size() == sizeof...(Index), "Mismatched parameter number!");
+
+		// Only filled for arguments that have to be converted
+		[[maybe_unused]] std::array<Handle, sizeof...(Index)> converted;
+
+		if constexpr (std::is_void_v<Return>)
+		{
+			std::invoke(MethodPtr, object, BindArgument<std::tuple_element_t<Index, Tuple>>(parameters[Index], converted[Index])...);
+			return {};
+		}
+		else
+		{
+			if (destination)
 			{
-				Program::Assert(parameters.size() == sizeof...(Index), "Mismatched parameter number!");
+				StoreResult(*destination, std::invoke(MethodPtr, object, BindArgument<std::tuple_element_t<Index, Tuple>>(parameters[Index], converted[Index])...));
+				return {};
+			}
 
-				if constexpr (std::is_void_v<Return>)
-				{
-					if constexpr (IsConst)
-					{
-						if (view.is<const T>())
-							// ReSharper is wrong
-							// ReSharper disable once CppRedundantTemplateKeyword
-							std::invoke(MethodPtr, view.as<const T>(), MapTo<std::tuple_element_t<Index, Tuple>>(parameters[Index]).template as<std::tuple_element_t<Index, Tuple>>()...);
-						else if (view.is<const T&>())
-							// ReSharper is wrong
-							// ReSharper disable once CppRedundantTemplateKeyword
-							std::invoke(MethodPtr, view.as<const T&>(), MapTo<std::tuple_element_t<Index, Tuple>>(parameters[Index]).template as<std::tuple_element_t<Index, Tuple>>()...);
-						else if (view.is<T>())
-							// ReSharper is wrong
-							// ReSharper disable once CppRedundantTemplateKeyword
-							std::invoke(MethodPtr, view.as<T>(), MapTo<std::tuple_element_t<Index, Tuple>>(parameters[Index]).template as<std::tuple_element_t<Index, Tuple>>()...);
-						else
-							// ReSharper is wrong
-							// ReSharper disable once CppRedundantTemplateKeyword
-							std::invoke(MethodPtr, view.as<T&>(), MapTo<std::tuple_element_t<Index, Tuple>>(parameters[Index]).template as<std::tuple_element_t<Index, Tuple>>()...);
-					}
-					else
-					{
-						if (view.is<T>())
-							// ReSharper is wrong
-							// ReSharper disable once CppRedundantTemplateKeyword
-							std::invoke(MethodPtr, view.as<T>(), MapTo<std::tuple_element_t<Index, Tuple>>(parameters[Index]).template as<std::tuple_element_t<Index, Tuple>>()...);
-						else
-							// ReSharper is wrong
-							// ReSharper disable once CppRedundantTemplateKeyword
-							std::invoke(MethodPtr, view.as<T&>(), MapTo<std::tuple_element_t<Index, Tuple>>(parameters[Index]).template as<std::tuple_element_t<Index, Tuple>>()...);
-					}
-				}
-				else
+			return Handle(std::invoke(MethodPtr, object, BindArgument<std::tuple_element_t<Index, Tuple>>(parameters[Index], converted[Index])...));
+		}
+	}
+
+	using MethodThunk = Handle (*)(void* object, const Spandle& parameters, const View* destination);
+
+	// How the receiver binds for each combination of its qualifiers, decided once per method rather than per call.
+	// Const methods run on the object whatever it is. Others need a mutable reference, or run on a copy of a
+	// temporary, as View::as() would have handed out.
+	template<typename T, auto MethodPtr, typename Return, bool IsConst, typename Tuple, std::size_t... Index>
+	constexpr std::array<MethodThunk, kQualifierCombinations> MethodThunks()
+	{
+		std::array<MethodThunk, kQualifierCombinations> thunks = {};
+
+		for (std::size_t index = 0; index < kQualifierCombinations; ++index)
+		{
+			const auto qualifiers = Qualifier(index);
+
+			thunks[index] = [](void*, const Spandle&, const View*) -> Handle
+			{
+				Program::Assert(false, "The object's qualifiers don't allow this method!");
+				return {};
+			};
+
+			if constexpr (IsConst)
+			{
+				if (QualifiersBind(qualifiers, QualifiersOf<const T>) || QualifiersBind(qualifiers, QualifiersOf<const T&>)
+					|| QualifiersBind(qualifiers, QualifiersOf<T>) || QualifiersBind(qualifiers, QualifiersOf<T&>))
 				{
-					if constexpr (IsConst)
-					{
-						if (view.is<const T>())
-							// ReSharper is wrong
-							// ReSharper disable once CppRedundantTemplateKeyword
-							result = Handle(std::invoke(MethodPtr, view.as<const T>(), MapTo<std::tuple_element_t<Index, Tuple>>(parameters[Index]).template as<std::tuple_element_t<Index, Tuple>>()...));
-						else if (view.is<const T&>())
-							// ReSharper is wrong
-							// ReSharper disable once CppRedundantTemplateKeyword
-							result = Handle(std::invoke(MethodPtr, view.as<const T&>(), MapTo<std::tuple_element_t<Index, Tuple>>(parameters[Index]).template as<std::tuple_element_t<Index, Tuple>>()...));
-						else if (view.is<T>())
-							// ReSharper is wrong
-							// ReSharper disable once CppRedundantTemplateKeyword
-							result = Handle(std::invoke(MethodPtr, view.as<T>(), MapTo<std::tuple_element_t<Index, Tuple>>(parameters[Index]).template as<std::tuple_element_t<Index, Tuple>>()...));
-						else
-							// ReSharper is wrong
-							// ReSharper disable once CppRedundantTemplateKeyword
-							result = Handle(std::invoke(MethodPtr, view.as<T&>(), MapTo<std::tuple_element_t<Index, Tuple>>(parameters[Index]).template as<std::tuple_element_t<Index, Tuple>>()...));
-					}
-					else
+					thunks[index] = [](void* object, const Spandle& parameters, const View* destination) -> Handle
 					{
-						if (view.is<T>())
-							// ReSharper is wrong
-							// ReSharper disable once CppRedundantTemplateKeyword
-							result = Handle(std::invoke(MethodPtr, view.as<T>(), MapTo<std::tuple_element_t<Index, Tuple>>(parameters[Index]).template as<std::tuple_element_t<Index, Tuple>>()...));
-						else
-							// ReSharper is wrong
-							// ReSharper disable once CppRedundantTemplateKeyword
-							result = Handle(std::invoke(MethodPtr, view.as<T&>(), MapTo<std::tuple_element_t<Index, Tuple>>(parameters[Index]).template as<std::tuple_element_t<Index, Tuple>>()...));
-					}
+						return CallMethod<MethodPtr, Return, Tuple, const T, Index...>(*static_cast<const T*>(object), parameters, destination);
+					};
 				}
 			}
-			else
+			else if (QualifiersBind(qualifiers, QualifiersOf<T&>))
 			{
-				Program::Assert(parameters.empty(), "Method takes no parameters!");
-
-				if constexpr (std::is_void_v<Return>)
+				thunks[index] = [](void* object, const Spandle& parameters, const View* destination) -> Handle
 				{
-					if constexpr (IsConst)
-					{
-						if (view.is<const T>())
-							(view.as<const T>().*MethodPtr)();
-						else if (view.is<const T&>())
-							(view.as<const T&>().*MethodPtr)();
-						else if (view.is<T>())
-							(view.as<T>().*MethodPtr)();
-						else
-							(view.as<T&>().*MethodPtr)();
-					}
-					else
-					{
-						if (view.is<T>())
-							(view.as<T>().*MethodPtr)();
-						else
-							(view.as<T&>().*MethodPtr)();
-					}
-				}
-				else
+					return CallMethod<MethodPtr, Return, Tuple, T, Index...>(*static_cast<T*>(object), parameters, destination);
+				};
+			}
+			else if constexpr (std::is_copy_constructible_v<T>)
+			{
+				if (QualifiersBind(qualifiers, QualifiersOf<T>))
 				{
-					if constexpr (IsConst)
+					thunks[index] = [](void* object, const Spandle& parameters, const View* destination) -> Handle
 					{
-						if (view.is<const T>())
-							result = Handle((view.as<const T>().*MethodPtr)());
-						else if (view.is<const T&>())
-							result = Handle((view.as<const T&>().*MethodPtr)());
-						else if (view.is<T>())
-							result = Handle((view.as<T>().*MethodPtr)());
-						else
-							result = Handle((view.as<T&>().*MethodPtr)());
-					}
-					else
-					{
-						if (view.is<T>())
-							result = Handle((view.as<T>().*MethodPtr)());
-						else
-							result = Handle((view.as<T&>().*MethodPtr)());
-					}
+						T copy = *static_cast<const T*>(object);
+						return CallMethod<MethodPtr, Return, Tuple, T, Index...>(copy, parameters, destination);
+					};
 				}
 			}
+		}
+
+		return thunks;
+	}
+
+	// Shared by both forms of the method
+	template<typename T, auto MethodPtr, typename Return, bool IsConst, typename Tuple, std::size_t... Index>
+	constexpr std::array<MethodThunk, kQualifierCombinations> kMethodThunks = MethodThunks<T, MethodPtr, Return, IsConst, Tuple, Index...>();
+
+	template<typename T, auto MethodPtr, typename Return, bool IsConst, typename Tuple, std::size_t... Index> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>>)
+	Method FromMethodImpl(std::index_sequence<Index...>)
+	{
+		return [](const View view, const Spandle& parameters) -> Handle
+		{
+			T* object = view.object<T>();
 
-			return result;
+			Program::Assert(object, "Not the correct type!");
+			return kMethodThunks<T, MethodPtr, Return, IsConst, Tuple, Index...>[view.get_qualifiers() & (kQualifierCombinations - 1)](object, parameters, nullptr);
+		};
+	}
+
+	template<typename T, auto MethodPtr, typename Return, bool IsConst, typename Tuple, std::size_t... Index> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>>)
+	MethodInto FromMethodIntoImpl(std::index_sequence<Index...>)
+	{
+		return [](const View destination, const View view, const Spandle& parameters)
+		{
+			T* object = view.object<T>();
+
+			Program::Assert(object, "Not the correct type!");
+			kMethodThunks<T, MethodPtr, Return, IsConst, Tuple, Index...>[view.get_qualifiers() & (kQualifierCombinations - 1)](object, parameters, &destination);
 		};
 	}
 
@@ -773,43 +1088,94 @@ namespace Meta
 		return FromMethodImpl<T, MethodPtr, Return, std::is_same_v<decltype(MethodPtr), Return (T::*)(Args...) const>, std::tuple<Args...>>(std::index_sequence_for<Args...>{});
 	}
 
+	// A method returning void leaves the destination alone
+	template<typename T, auto MethodPtr, typename Return, typename... Args> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>>)
+	MethodInto FromMethodInto()
+	{
+		static_assert(std::is_same_v<decltype(MethodPtr), Return (T::*)(Args...)> || std::is_same_v<decltype(MethodPtr), Return (T::*)(Args...) const>, "MethodPtr is not a valid method pointer!");
+		return FromMethodIntoImpl<T, MethodPtr, Return, std::is_same_v<decltype(MethodPtr), Return (T::*)(Args...) const>, std::tuple<Args...>>(std::index_sequence_for<Args...>{});
+	}
+
+	// Methods are keyed on the name's interned storage, so names must come from LiteralName() or StringName(). One name
+	// can hold several overloads, one per signature, each with an optional Into form.
+	bool AddMethod(const Information& info, const Program::Name name, const Method method, const FunctionSignature signature); // NOLINT(*-avoid-const-params-in-decls)
+	bool AddMethod(const Information& info, const Program::Name name, const Method method, const MethodInto method_into, const FunctionSignature signature); // NOLINT(*-avoid-const-params-in-decls)
+
+	template<typename T, auto MethodPtr, typename Return, typename... Args> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>>)
+	bool AddMethod(const Program::Name name)
+	{
+		return AddMethod(Info<T>(), name, FromMethod<T, MethodPtr, Return, Args...>(), FromMethodInto<T, MethodPtr, Return, Args...>(), FromParameterList<Args...>());
+	}
+
+	// A type sees the methods it declares, then those of its bases in declaration order for names it doesn't declare.
+	// Like C++ name hiding, declaring a name hides every base overload of it.
+	bool HasMethod(const Information& info, const Program::Name name); // NOLINT(*-avoid-const-params-in-decls)
+	Method GetMethod(const Information& info, const Program::Name name, const FunctionSignature signature); // NOLINT(*-avoid-const-params-in-decls)
+	Method GetMethod(const Information& info, const Program::Name name, const SignatureId signature); // NOLINT(*-avoid-const-params-in-decls)
+
+	template<typename T, typename... Args> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>>)
+	Method GetMethod(const Program::Name name)
+	{
+		return GetMethod(Info<T>(), name, SignatureIdOf<Args...>());
+	}
+
+	// The overload's Into form, asserting if it was registered without one
+	MethodInto GetMethodInto(const Information& info, const Program::Name name, const SignatureId signature); // NOLINT(*-avoid-const-params-in-decls)
+
+	template<typename T, typename... Args> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>>)
+	MethodInto GetMethodInto(const Program::Name name)
+	{
+		return GetMethodInto(Info<T>(), name, SignatureIdOf<Args...>());
+	}
+
 	// -----------------------------------------------------------------------------------------------------------------
 	// Functions
 	// -----------------------------------------------------------------------------------------------------------------
 
 	using Function = Handle (*)(const Spandle&);
+	using FunctionInto = void (*)(const View destination, const Spandle& parameters);
 
+	// Returns the result, or stores it and returns nothing when given a destination
 	template<auto FunctionPtr, typename Return, typename Tuple, std::size_t... Index>
-	Function FromFunctionImpl(std::index_sequence<Index...>)
+	Handle CallFunction(const Spandle& parameters, const View* destination)
 	{
-		return [](const Spandle& parameters) -> Handle
-		{
-			Handle result;
+		Program::Assert(parameters.size() == sizeof...(Index), "Mismatched parameter number!");
 
-			if constexpr (sizeof...(Index) > 0)
-			{
-				Program::Assert(parameters.size() == sizeof...(Index), "Mismatched parameter number!");
+		// Only filled for arguments that have to be converted
+		[[maybe_unused]] std::array<Handle, sizeof...(Index)> converted;
 
-				if constexpr (std::is_void_v<Return>)
-					// ReSharper is wrong
-					// ReSharper disable once CppRedundantTemplateKeyword
-					(FunctionPtr)(MapTo<std::tuple_element_t<Index, Tuple>>(parameters[Index]).template as<std::tuple_element_t<Index, Tuple>>()...);
-				else
-					// ReSharper is wrong
-					// ReSharper disable once CppRedundantTemplateKeyword
-					result = Handle((FunctionPtr)(MapTo<std::tuple_element_t<Index, Tuple>>(parameters[Index]).template as<std::tuple_element_t<Index, Tuple>>()...));
-			}
-			else
+		if constexpr (std::is_void_v<Return>)
+		{
+			(FunctionPtr)(BindArgument<std::tuple_element_t<Index, Tuple>>(parameters[Index], converted[Index])...);
+			return {};
+		}
+		else
+		{
+			if (destination)
 			{
-				Program::Assert(parameters.empty(), "Method takes no parameters!");
-
-				if constexpr (std::is_void_v<Return>)
-					(FunctionPtr)();
-				else
-					result = Handle((FunctionPtr)());
+				StoreResult(*destination, (FunctionPtr)(BindArgument<std::tuple_element_t<Index, Tuple>>(parameters[Index], converted[Index])...));
+				return {};
 			}
 
-			return result;
+			return Handle((FunctionPtr)(BindArgument<std::tuple_element_t<Index, Tuple>>(parameters[Index], converted[Index])...));
+		}
+	}
+
+	template<auto FunctionPtr, typename Return, typename Tuple, std::size_t... Index>
+	Function FromFunctionImpl(std::index_sequence<Index...>)
+	{
+		return [](const Spandle& parameters) -> Handle
+		{
+			return CallFunction<FunctionPtr, Return, Tuple, Index...>(parameters, nullptr);
+		};
+	}
+
+	template<auto FunctionPtr, typename Return, typename Tuple, std::size_t... Index>
+	FunctionInto FromFunctionIntoImpl(std::index_sequence<Index...>)
+	{
+		return [](const View destination, const Spandle& parameters)
+		{
+			CallFunction<FunctionPtr, Return, Tuple, Index...>(parameters, &destination);
 		};
 	}
 
@@ -820,6 +1186,14 @@ namespace Meta
 		return FromFunctionImpl<FunctionPtr, Return, std::tuple<Args...>>(std::index_sequence_for<Args...>{});
 	}
 
+	// A function returning void leaves the destination alone
+	template<auto FunctionPtr, typename Return, typename... Args>
+	FunctionInto FromFunctionInto()
+	{
+		static_assert(std::is_same_v<decltype(FunctionPtr), Return (*)(Args...)>, "FunctionPtr is not a valid function pointer!");
+		return FromFunctionIntoImpl<FunctionPtr, Return, std::tuple<Args...>>(std::index_sequence_for<Args...>{});
+	}
+
 	// -----------------------------------------------------------------------------------------------------------------
 	// Members
 	// -----------------------------------------------------------------------------------------------------------------
@@ -848,6 +1222,87 @@ namespace Meta
 		return FromMemberImpl<MemberPtr, T>();
 	}
 
+	using MemberInto = void (*)(const View destination, const View object);
+
+	// Reading the member never needs more than a const object, so any qualifiers will do
+	template<typename T, auto MemberPtr, typename Return> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>>)
+	MemberInto FromMemberInto()
+	{
+		static_assert(std::is_same_v<decltype(MemberPtr), Return (T::*)>, "MemberPtr is not a valid member pointer!");
+
+		return [](const View destination, const View view)
+		{
+			const T* object = view.object<T>();
+
+			Program::Assert(object, "Not the correct type!");
+			StoreResult(destination, object->*MemberPtr);
+		};
+	}
+
+	// Copies one field value onto another of the same type. Null when the bytes can simply be copied.
+	using FieldCopier = void (*)(void* target, const void* source);
+
+	// Where a registered member lives inside its owner, so it can be reached without a getter or a Handle
+	struct Field
+	{
+		Program::Name name;
+		std::size_t offset = 0;
+		Index owner = kInvalidType;
+		Index type = kInvalidType;
+		Qualifier qualifiers = kQualifier_Reference; // Const and volatile of the member's declaration
+		FieldCopier copier = nullptr;
+	};
+
+	template<typename T, auto MemberPtr, typename Return> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>>)
+	Field FromField(const Program::Name name, const std::size_t offset)
+	{
+		static_assert(std::is_same_v<decltype(MemberPtr), Return (T::*)>, "MemberPtr is not a valid member pointer!");
+		static_assert(std::is_standard_layout_v<T>, "Fields are only stored for standard layout types!");
+
+		using Type = std::remove_cv_t<Return>;
+
+		Field field = {
+			.name = name,
+			.offset = offset,
+			.owner = Info<T>().index,
+			.type = Info<Type>().index,
+			.qualifiers = Qualifier(QualifiersOf<Return&> & (kQualifier_Constant | kQualifier_Volatile | kQualifier_Reference)),
+		};
+
+		if constexpr (!std::is_trivially_copyable_v<Type> && std::is_copy_assignable_v<Type>)
+			field.copier = [](void* target, const void* source) { *static_cast<Type*>(target) = *static_cast<const Type*>(source); };
+		else if constexpr (!std::is_trivially_copyable_v<Type>)
+			field.copier = [](void*, const void*) { Program::Assert(false, "Field cannot be copied!"); };
+
+		return field;
+	}
+
+	// Fields are keyed on the name's interned storage like methods. Non-trivially copyable fields need a copier to be
+	// written in bulk.
+	bool AddField(const Information& info, const Field& field); // NOLINT(*-avoid-const-params-in-decls)
+
+	// Offsets come from offsetof(), see META_FIELD
+	template<typename T, auto MemberPtr, typename Return> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>>)
+	bool AddField(const Program::Name name, const std::size_t offset)
+	{
+		return AddField(Info<T>(), FromField<T, MemberPtr, Return>(name, offset));
+	}
+
+	// Only the type's own fields, sorted by name storage. What they return stays valid for the lifetime of the program.
+	const Field* FindField(const Information& info, const Program::Name name); // NOLINT(*-avoid-const-params-in-decls)
+	const Field& GetField(const Information& info, const Program::Name name); // NOLINT(*-avoid-const-params-in-decls)
+	std::span<const Field> GetFields(const Information& info);
+
+	// A reference View into the object, const if either the object or the member is. Objects of derived types work as
+	// long as View::as() could see them as the field's owner.
+	View FieldOf(const View object, const Field& field); // NOLINT(*-avoid-const-params-in-decls)
+
+	// Bulk access over count contiguous objects of the field's owner, using the stored offset as a stride. Values are
+	// assigned, so every destination, values included for ReadField(), must already hold constructed objects.
+	void ReadField(const Field& field, const void* objects, void* values, const std::size_t count); // NOLINT(*-avoid-const-params-in-decls)
+	void WriteField(const Field& field, void* objects, const void* values, const std::size_t count); // NOLINT(*-avoid-const-params-in-decls)
+	void CopyField(const Field& field, const void* source, void* target, const std::size_t count); // NOLINT(*-avoid-const-params-in-decls)
+
 	// -----------------------------------------------------------------------------------------------------------------
 	// Constructors
 	// -----------------------------------------------------------------------------------------------------------------
@@ -889,11 +1344,13 @@ namespace Meta
 	}
 
 	Constructor GetConstructor(const Information& info, const FunctionSignature signature); // NOLINT(*-avoid-const-params-in-decls)
+	Constructor GetConstructor(const Information& info, const SignatureId signature); // NOLINT(*-avoid-const-params-in-decls)
 
 	template<typename T, typename... Args> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>>)
 	Constructor GetConstructor()
 	{
-		return GetConstructor(Info<T>(), FromParameterList<Args...>());
+		thread_local DispatchCache<Constructor, 1> cache;
+		return cache.get(Info<T>().index, SignatureIdOf<Args...>(), [] { return GetConstructor(Info<T>(), SignatureIdOf<Args...>()); });
 	}
 
 	// -----------------------------------------------------------------------------------------------------------------
@@ -953,13 +1410,105 @@ namespace Meta
 	}
 
 	Assigner GetAssigner(const Information& info, const FunctionSignature signature); // NOLINT(*-avoid-const-params-in-decls)
+	Assigner GetAssigner(const Information& info, const SignatureId signature); // NOLINT(*-avoid-const-params-in-decls)
 
 	template<typename T, typename... Args>
 	Assigner GetAssigner()
 	{
-		return GetAssigner(Info<T>(), FromParameterList<Args...>());
+		thread_local DispatchCache<Assigner, 1> cache;
+		return cache.get(Info<T>().index, SignatureIdOf<Args...>(), [] { return GetAssigner(Info<T>(), SignatureIdOf<Args...>()); });
 	}
 
+	// -----------------------------------------------------------------------------------------------------------------
+	// Conversion Plans
+	// -----------------------------------------------------------------------------------------------------------------
+
+	// A chain of registered converters from one type to another. Intermediate values are built in place in one stack
+	// scratch buffer and destroyed once the next step has read them, so only the result takes a Handle. Steps without
+	// an in-place form, or that don't fit in kConversionScratchBytes, fall back on a Handle of their own.
+	class ConversionPlan
+	{
+	public:
+		[[nodiscard]] bool valid() const { return !steps.empty(); }
+		[[nodiscard]] std::size_t size() const { return steps.size(); }
+
+		[[nodiscard]] Handle execute(const View source) const; // NOLINT(*-avoid-const-params-in-decls)
+
+	private:
+		struct Step
+		{
+			Converter converter = nullptr;
+			InPlaceConverter in_place = nullptr; // Null unless the result goes to the scratch buffer
+			Destructor destructor = nullptr;
+			const Information* info = nullptr; // Of the result
+			std::size_t offset = 0; // In the scratch buffer
+		};
+
+		OS::Vector<Step> steps;
+
+		friend class ConversionPlanner;
+	};
+
+	// The fewest steps, and among those the fewest that need a Handle. Found on the first request and memoized until
+	// the next registration. Invalid if there is no chain.
+	ConversionPlan PlanConversion(const Information& info_a, const Information& info_b);
+
+	template<typename T, typename U> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>> && std::is_same_v<U, std::remove_pointer_t<std::remove_cvref_t<U>>>)
+	ConversionPlan PlanConversion()
+	{
+		return PlanConversion(Info<T>(), Info<U>());
+	}
+
+	// -----------------------------------------------------------------------------------------------------------------
+	// Overload Resolution
+	// -----------------------------------------------------------------------------------------------------------------
+
+	// How an argument reaches its parameter, in the order MapTo() prefers them
+	enum Conversion : u8
+	{
+		kConversion_Exact,
+		kConversion_Convert,
+		kConversion_Cast,
+
+		kConversion_None
+	};
+
+	enum OverloadSet : u8
+	{
+		kOverloadSet_Constructors,
+		kOverloadSet_Assigners,
+		kOverloadSet_Methods,
+
+		kOverloadSet_Count
+	};
+
+	constexpr std::size_t kMaximumOverloadArguments = 32;
+
+	struct Overload
+	{
+		SignatureId signature = kInvalidSignature; // The chosen overload's parameters
+		u32 cost = 0;                              // Sum of the arguments' conversions
+		u64 conversions = 0;                       // Two bits per argument
+
+		[[nodiscard]] bool valid() const { return signature != kInvalidSignature; }
+		[[nodiscard]] Conversion get_conversion(const std::size_t argument) const { return Conversion((conversions >> (argument * 2)) & 0b11); }
+	};
+
+	// Ranks every overload of the set with as many parameters as there are arguments, cheapest total conversion first
+	// and the earlier interned signature on ties. The winner and its plan are remembered per argument signature until
+	// the registry changes, so repeated calls with the same argument types skip straight to the call.
+	Overload ResolveOverload(const OverloadSet set, const Information& info, const Spandle& arguments); // NOLINT(*-avoid-const-params-in-decls)
+	// The same over the overloads of the name that the type sees
+	Overload ResolveMethod(const Information& info, const Program::Name name, const Spandle& arguments); // NOLINT(*-avoid-const-params-in-decls)
+
+	// Runs the best constructor or assigner for the arguments, converting them as the overload's plan says
+	void Construct(const Information& info, const View target, const Spandle& arguments); // NOLINT(*-avoid-const-params-in-decls)
+	View Assign(const Information& info, const View target, const Spandle& arguments); // NOLINT(*-avoid-const-params-in-decls)
+	Handle Invoke(const Information& info, const Program::Name name, const View object, const Spandle& arguments); // NOLINT(*-avoid-const-params-in-decls)
+	// Stores the result into destination through the overload's Into form, or assigns it from the Handle form when
+	// the overload has none
+	void InvokeInto(const Information& info, const Program::Name name, const View destination, const View object, const Spandle& arguments); // NOLINT(*-avoid-const-params-in-decls)
+
 	// -----------------------------------------------------------------------------------------------------------------
 	// Logic
 	// -----------------------------------------------------------------------------------------------------------------
@@ -967,6 +1516,20 @@ namespace Meta
 	using UnaryOperator  = Handle (*)(const View);
 	using BinaryOperator = Handle (*)(const View, const View);
 
+	// The same operators writing their result into a destination instead of a new Handle, see StoreResult()
+	using UnaryOperatorInto  = void (*)(const View destination, const View operand);
+	using BinaryOperatorInto = void (*)(const View destination, const View lhs, const View rhs);
+
+	// Operators of derived types often return the base, as Math's vectors do, so the result is narrowed back to T
+	template<typename T, typename R>
+	auto OperatorResult(R&& result)
+	{
+		if constexpr (std::is_class_v<T> && std::is_base_of_v<std::remove_cvref_t<R>, T> && !std::is_same_v<std::remove_cvref_t<R>, T>)
+			return T(std::forward<R>(result));
+		else
+			return std::remove_cvref_t<R>(std::forward<R>(result));
+	}
+
 	// Math
 
 	template<typename T> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>>)
@@ -974,7 +1537,7 @@ namespace Meta
 	{
 		return [](const View view) -> Handle
 		{
-			return Handle(+view.as<T>());
+			return Handle(OperatorResult<T>(+view.as<T>()));
 		};
 	}
 
@@ -983,7 +1546,7 @@ namespace Meta
 	{
 		return [](const View view) -> Handle
 		{
-			return Handle(-view.as<T>());
+			return Handle(OperatorResult<T>(-view.as<T>()));
 		};
 	}
 
@@ -1040,7 +1603,7 @@ namespace Meta
 	{
 		return [](const View a, const View b) -> Handle
 		{
-			return Handle(a.as<T>() + T(b.as<U>()));
+			return Handle(OperatorResult<T>(a.as<T>() + T(b.as<U>())));
 		};
 	}
 
@@ -1059,7 +1622,7 @@ namespace Meta
 	{
 		return [](const View a, const View b) -> Handle
 		{
-			return Handle(a.as<T>() - T(b.as<U>()));
+			return Handle(OperatorResult<T>(a.as<T>() - T(b.as<U>())));
 		};
 	}
 
@@ -1078,7 +1641,7 @@ namespace Meta
 	{
 		return [](const View a, const View b) -> Handle
 		{
-			return Handle(a.as<T>() * T(b.as<U>()));
+			return Handle(OperatorResult<T>(a.as<T>() * T(b.as<U>())));
 		};
 	}
 
@@ -1097,7 +1660,7 @@ namespace Meta
 	{
 		return [](const View a, const View b) -> Handle
 		{
-			return Handle(a.as<T>() / T(b.as<U>()));
+			return Handle(OperatorResult<T>(a.as<T>() / T(b.as<U>())));
 		};
 	}
 
@@ -1116,7 +1679,7 @@ namespace Meta
 	{
 		return [](const View a, const View b) -> Handle
 		{
-			return Handle(a.as<T>() % T(b.as<U>()));
+			return Handle(OperatorResult<T>(a.as<T>() % T(b.as<U>())));
 		};
 	}
 
@@ -1127,7 +1690,7 @@ namespace Meta
 	{
 		return [](const View view) -> Handle
 		{
-			return Handle(~view.as<T>());
+			return Handle(OperatorResult<T>(~view.as<T>()));
 		};
 	}
 
@@ -1146,7 +1709,7 @@ namespace Meta
 	{
 		return [](const View a, const View b) -> Handle
 		{
-			return Handle(a.as<T>() & T(b.as<U>()));
+			return Handle(OperatorResult<T>(a.as<T>() & T(b.as<U>())));
 		};
 	}
 
@@ -1165,7 +1728,7 @@ namespace Meta
 	{
 		return [](const View a, const View b) -> Handle
 		{
-			return Handle(a.as<T>() | T(b.as<U>()));
+			return Handle(OperatorResult<T>(a.as<T>() | T(b.as<U>())));
 		};
 	}
 
@@ -1184,7 +1747,7 @@ namespace Meta
 	{
 		return [](const View a, const View b) -> Handle
 		{
-			return Handle(a.as<T>() ^ T(b.as<U>()));
+			return Handle(OperatorResult<T>(a.as<T>() ^ T(b.as<U>())));
 		};
 	}
 
@@ -1203,7 +1766,7 @@ namespace Meta
 	{
 		return [](const View a, const View b) -> Handle
 		{
-			return Handle(a.as<T>() << T(b.as<U>()));
+			return Handle(OperatorResult<T>(a.as<T>() << T(b.as<U>())));
 		};
 	}
 
@@ -1222,7 +1785,7 @@ namespace Meta
 	{
 		return [](const View a, const View b) -> Handle
 		{
-			return Handle(a.as<T>() >> T(b.as<U>()));
+			return Handle(OperatorResult<T>(a.as<T>() >> T(b.as<U>())));
 		};
 	}
 
@@ -1369,8 +1932,177 @@ namespace Meta
 		kComparisonOperation_Final = kComparisonOperation_GreaterThanOrEquals
 	};
 
+	// Logic and comparisons compute a bool whatever the operand types
+	constexpr bool IsBooleanResult(const BinaryOperation operation)
+	{
+		return operation == kBinaryOperation_LogicalAnd || operation == kBinaryOperation_LogicalOr
+			|| (operation >= kComparisonOperation_Initial && operation <= kComparisonOperation_Final);
+	}
+
+	// What an operator computes for its Into form. Into forms store what the Handle forms return: the new value for
+	// compound assignments and prefix steps, the old one for postfix steps, a bool for logic and comparisons, and the
+	// operator's result otherwise. Assignments are read back as T since a derived type's may return its base.
+	template<typename T, UnaryOperation Op> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>>)
+	auto EvaluateUnaryOp(const View operand)
+	{
+		static_assert(Op >= kUnaryOperation_Initial && Op < kUnaryOperation_Count, "Not a valid unary operator!");
+
+		if constexpr (Op == kUnaryOperation_PrefixIncrement)
+			return static_cast<const T&>(++operand.as<T&>());
+		else if constexpr (Op == kUnaryOperation_PrefixDecrement)
+			return static_cast<const T&>(--operand.as<T&>());
+		else if constexpr (Op == kUnaryOperation_PostfixIncrement)
+			return operand.as<T&>()++;
+		else if constexpr (Op == kUnaryOperation_PostfixDecrement)
+			return operand.as<T&>()--;
+		else if constexpr (Op == kUnaryOperation_Positive)
+			return OperatorResult<T>(+operand.as<T>());
+		else if constexpr (Op == kUnaryOperation_Negative)
+			return OperatorResult<T>(-operand.as<T>());
+		else if constexpr (Op == kUnaryOperation_BitwiseNot)
+			return OperatorResult<T>(~operand.as<T>());
+		else if constexpr (Op == kUnaryOperation_LogicalNot)
+			return !operand.as<const T&>();
+	}
+
+	template<typename T, typename U, BinaryOperation Op> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>> && std::is_same_v<U, std::remove_pointer_t<std::remove_cvref_t<U>>>)
+	auto EvaluateBinaryOp(const View a, const View b)
+	{
+		static_assert(Op >= kBinaryOperation_Initial && Op < kBinaryOperation_Count, "Not a valid binary operator!");
+
+		if constexpr (Op == kBinaryOperation_AddEquals)
+			return static_cast<const T&>(a.as<T&>() += T(b.as<U>()));
+		else if constexpr (Op == kBinaryOperation_SubEquals)
+			return static_cast<const T&>(a.as<T&>() -= T(b.as<U>()));
+		else if constexpr (Op == kBinaryOperation_MulEquals)
+			return static_cast<const T&>(a.as<T&>() *= T(b.as<U>()));
+		else if constexpr (Op == kBinaryOperation_DivEquals)
+			return static_cast<const T&>(a.as<T&>() /= T(b.as<U>()));
+		else if constexpr (Op == kBinaryOperation_ModEquals)
+			return static_cast<const T&>(a.as<T&>() %= T(b.as<U>()));
+		else if constexpr (Op == kBinaryOperation_BitwiseAndEquals)
+			return static_cast<const T&>(a.as<T&>() &= T(b.as<U>()));
+		else if constexpr (Op == kBinaryOperation_BitwiseOrEquals)
+			return static_cast<const T&>(a.as<T&>() |= T(b.as<U>()));
+		else if constexpr (Op == kBinaryOperation_BitwiseXorEquals)
+			return static_cast<const T&>(a.as<T&>() ^= T(b.as<U>()));
+		else if constexpr (Op == kBinaryOperation_BitwiseLeftShiftEquals)
+			return static_cast<const T&>(a.as<T&>() <<= T(b.as<U>()));
+		else if constexpr (Op == kBinaryOperation_BitwiseRightShiftEquals)
+			return static_cast<const T&>(a.as<T&>() >>= T(b.as<U>()));
+		else if constexpr (Op == kBinaryOperation_Add)
+			return OperatorResult<T>(a.as<T>() + T(b.as<U>()));
+		else if constexpr (Op == kBinaryOperation_Sub)
+			return OperatorResult<T>(a.as<T>() - T(b.as<U>()));
+		else if constexpr (Op == kBinaryOperation_Mul)
+			return OperatorResult<T>(a.as<T>() * T(b.as<U>()));
+		else if constexpr (Op == kBinaryOperation_Div)
+			return OperatorResult<T>(a.as<T>() / T(b.as<U>()));
+		else if constexpr (Op == kBinaryOperation_Mod)
+			return OperatorResult<T>(a.as<T>() % T(b.as<U>()));
+		else if constexpr (Op == kBinaryOperation_BitwiseAnd)
+			return OperatorResult<T>(a.as<T>() & T(b.as<U>()));
+		else if constexpr (Op == kBinaryOperation_BitwiseOr)
+			return OperatorResult<T>(a.as<T>() | T(b.as<U>()));
+		else if constexpr (Op == kBinaryOperation_BitwiseXor)
+			return OperatorResult<T>(a.as<T>() ^ T(b.as<U>()));
+		else if constexpr (Op == kBinaryOperation_BitwiseLeftShift)
+			return OperatorResult<T>(a.as<T>() << T(b.as<U>()));
+		else if constexpr (Op == kBinaryOperation_BitwiseRightShift)
+			return OperatorResult<T>(a.as<T>() >> T(b.as<U>()));
+		else if constexpr (Op == kBinaryOperation_LogicalAnd)
+			return a.as<const T&>() && b.as<const U&>();
+		else if constexpr (Op == kBinaryOperation_LogicalOr)
+			return a.as<const T&>() || b.as<const U&>();
+		else if constexpr (Op == kComparisonOperation_Equals)
+			return a.as<const T&>() == b.as<const U&>();
+		else if constexpr (Op == kComparisonOperation_NotEquals)
+			return a.as<const T&>() != b.as<const U&>();
+		else if constexpr (Op == kComparisonOperation_LessThan)
+			return a.as<const T&>() < b.as<const U&>();
+		else if constexpr (Op == kComparisonOperation_LessThanOrEquals)
+			return a.as<const T&>() <= b.as<const U&>();
+		else if constexpr (Op == kComparisonOperation_GreaterThan)
+			return a.as<const T&>() > b.as<const U&>();
+		else if constexpr (Op == kComparisonOperation_GreaterThanOrEquals)
+			return a.as<const T&>() >= b.as<const U&>();
+	}
+
+	// The type an Into form stores, which is recorded with it so expressions can be typed without running anything
+	template<typename T, UnaryOperation Op>
+	using UnaryOpResult = decltype(EvaluateUnaryOp<T, Op>(std::declval<View>()));
+
+	template<typename T, typename U, BinaryOperation Op>
+	using BinaryOpResult = decltype(EvaluateBinaryOp<T, U, Op>(std::declval<View>(), std::declval<View>()));
+
+	template<typename T, UnaryOperation Op> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>>)
+	UnaryOperatorInto FromUnaryOpInto()
+	{
+		return [](const View destination, const View operand)
+		{
+			StoreResult(destination, EvaluateUnaryOp<T, Op>(operand));
+		};
+	}
+
+	template<typename T, typename U, BinaryOperation Op> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>> && std::is_same_v<U, std::remove_pointer_t<std::remove_cvref_t<U>>>)
+	BinaryOperatorInto FromBinaryOpInto()
+	{
+		return [](const View destination, const View a, const View b)
+		{
+			StoreResult(destination, EvaluateBinaryOp<T, U, Op>(a, b));
+		};
+	}
+
+	// The templated registrations below add both forms of an operator, each under the same signature
 	bool AddUnaryOp(const Information& info, const UnaryOperator unary_operator, const UnaryOperation type, const FunctionSignature signature); // NOLINT(*-avoid-const-params-in-decls)
 	bool AddBinaryOp(const Information& info, const BinaryOperator binary_operator, const BinaryOperation type, const FunctionSignature signature); // NOLINT(*-avoid-const-params-in-decls)
+	bool AddUnaryOp(const Information& info, const UnaryOperator unary_operator, const UnaryOperatorInto unary_operator_into, const Index result, const UnaryOperation type, const FunctionSignature signature); // NOLINT(*-avoid-const-params-in-decls)
+	bool AddBinaryOp(const Information& info, const BinaryOperator binary_operator, const BinaryOperatorInto binary_operator_into, const Index result, const BinaryOperation type, const FunctionSignature signature); // NOLINT(*-avoid-const-params-in-decls)
+
+	UnaryOperator GetUnaryOp(const Information& info, const UnaryOperation type, const FunctionSignature signature); // NOLINT(*-avoid-const-params-in-decls)
+	BinaryOperator GetBinaryOp(const Information& info, const BinaryOperation type, const FunctionSignature signature); // NOLINT(*-avoid-const-params-in-decls)
+	UnaryOperator GetUnaryOp(const Information& info, const UnaryOperation type, const SignatureId signature); // NOLINT(*-avoid-const-params-in-decls)
+	BinaryOperator GetBinaryOp(const Information& info, const BinaryOperation type, const SignatureId signature); // NOLINT(*-avoid-const-params-in-decls)
+
+	// Runs the operator registered for the operands' types, whatever their qualifiers. The first call after anything
+	// registers rebuilds the dispatch tables, filling every lazy operator table as Freeze() does; after that a lookup
+	// is a few array loads, plus a hash probe for operands of different types.
+	Handle Apply(const UnaryOperation operation, const View operand); // NOLINT(*-avoid-const-params-in-decls)
+	Handle Apply(const BinaryOperation operation, const View lhs, const View rhs); // NOLINT(*-avoid-const-params-in-decls)
+
+	// Three-address forms of Apply() storing into destination, see StoreResult(). Operators registered without an Into
+	// form run their Handle form and the result is assigned with the destination type's assigner.
+	void ApplyInto(const UnaryOperation operation, const View destination, const View operand); // NOLINT(*-avoid-const-params-in-decls)
+	void ApplyInto(const BinaryOperation operation, const View destination, const View lhs, const View rhs); // NOLINT(*-avoid-const-params-in-decls)
+
+	bool CanApply(const UnaryOperation operation, const Information& operand); // NOLINT(*-avoid-const-params-in-decls)
+	bool CanApply(const BinaryOperation operation, const Information& lhs, const Information& rhs); // NOLINT(*-avoid-const-params-in-decls)
+
+	// The operators Apply() would run, for callers that resolve once and loop
+	UnaryOperator GetUnaryOp(const Information& info, const UnaryOperation type); // NOLINT(*-avoid-const-params-in-decls)
+	BinaryOperator GetBinaryOp(const Information& lhs, const BinaryOperation type, const Information& rhs); // NOLINT(*-avoid-const-params-in-decls)
+	// Null rather than asserting when only the Handle form was registered
+	UnaryOperatorInto FindUnaryOpInto(const Information& info, const UnaryOperation type); // NOLINT(*-avoid-const-params-in-decls)
+	BinaryOperatorInto FindBinaryOpInto(const Information& lhs, const BinaryOperation type, const Information& rhs); // NOLINT(*-avoid-const-params-in-decls)
+	// The type those Into forms store, kInvalidType without one
+	Index FindUnaryOpResult(const Information& info, const UnaryOperation type); // NOLINT(*-avoid-const-params-in-decls)
+	Index FindBinaryOpResult(const Information& lhs, const BinaryOperation type, const Information& rhs); // NOLINT(*-avoid-const-params-in-decls)
+
+	// Applies the operator element-wise over count values of the type laid out contiguously. out receives count
+	// bools for comparisons and logical operators, otherwise count values of the type constructed into uninitialized
+	// storage; for primitives it may alias lhs or rhs exactly. i32, f32 and f64 run SIMD kernels picked on first use
+	// (AVX2, else SSE2), other primitives loop over the values directly, and any other type calls its registered
+	// operator per element. Compound assignments aren't batched: pass the plain operator with out set to lhs.
+	void ApplyBatch(const BinaryOperation operation, const Information& info, const void* lhs, const void* rhs, void* out, const std::size_t count); // NOLINT(*-avoid-const-params-in-decls)
+
+	// R is bool for comparisons and logical operators, T otherwise
+	template<typename T, typename R> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>> && (std::is_same_v<R, T> || std::is_same_v<R, bool>))
+	void ApplyBatch(const BinaryOperation operation, const T* lhs, const T* rhs, R* out, const std::size_t count)
+	{
+		Program::Assert(std::is_same_v<R, bool> == IsBooleanResult(operation) || std::is_same_v<T, bool>, "The batch's result type doesn't match the operator!");
+
+		ApplyBatch(operation, Info<T>(), lhs, rhs, out, count);
+	}
 
 	template<typename T, UnaryOperation Op> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>>)
 	bool AddUnaryOp()
@@ -1378,21 +2110,21 @@ namespace Meta
 		static_assert(Op >= kUnaryOperation_Initial && Op < kUnaryOperation_Count, "Not a valid unary operator!");
 
 		if constexpr (Op == kUnaryOperation_PrefixIncrement)
-			return AddUnaryOp(Info<T>(), FromPrefixIncrement<T>(), kUnaryOperation_PrefixIncrement, FromParameterList<T&>());
+			return AddUnaryOp(Info<T>(), FromPrefixIncrement<T>(), FromUnaryOpInto<T, kUnaryOperation_PrefixIncrement>(), Info<UnaryOpResult<T, kUnaryOperation_PrefixIncrement>>().index, kUnaryOperation_PrefixIncrement, FromParameterList<T&>());
 		else if constexpr (Op == kUnaryOperation_PrefixDecrement)
-			return AddUnaryOp(Info<T>(), FromPrefixDecrement<T>(), kUnaryOperation_PrefixDecrement, FromParameterList<T&>());
+			return AddUnaryOp(Info<T>(), FromPrefixDecrement<T>(), FromUnaryOpInto<T, kUnaryOperation_PrefixDecrement>(), Info<UnaryOpResult<T, kUnaryOperation_PrefixDecrement>>().index, kUnaryOperation_PrefixDecrement, FromParameterList<T&>());
 		else if constexpr (Op == kUnaryOperation_PostfixIncrement)
-			return AddUnaryOp(Info<T>(), FromPostfixIncrement<T>(), kUnaryOperation_PostfixIncrement, FromParameterList<T&>());
+			return AddUnaryOp(Info<T>(), FromPostfixIncrement<T>(), FromUnaryOpInto<T, kUnaryOperation_PostfixIncrement>(), Info<UnaryOpResult<T, kUnaryOperation_PostfixIncrement>>().index, kUnaryOperation_PostfixIncrement, FromParameterList<T&>());
 		else if constexpr (Op == kUnaryOperation_PostfixDecrement)
-			return AddUnaryOp(Info<T>(), FromPostfixDecrement<T>(), kUnaryOperation_PostfixDecrement, FromParameterList<T&>());
+			return AddUnaryOp(Info<T>(), FromPostfixDecrement<T>(), FromUnaryOpInto<T, kUnaryOperation_PostfixDecrement>(), Info<UnaryOpResult<T, kUnaryOperation_PostfixDecrement>>().index, kUnaryOperation_PostfixDecrement, FromParameterList<T&>());
 		else if constexpr (Op == kUnaryOperation_Positive)
-			return AddUnaryOp(Info<T>(), FromPositive<T>(), kUnaryOperation_Positive, FromParameterList<T>());
+			return AddUnaryOp(Info<T>(), FromPositive<T>(), FromUnaryOpInto<T, kUnaryOperation_Positive>(), Info<UnaryOpResult<T, kUnaryOperation_Positive>>().index, kUnaryOperation_Positive, FromParameterList<T>());
 		else if constexpr (Op == kUnaryOperation_Negative)
-			return AddUnaryOp(Info<T>(), FromNegative<T>(), kUnaryOperation_Negative, FromParameterList<T>());
+			return AddUnaryOp(Info<T>(), FromNegative<T>(), FromUnaryOpInto<T, kUnaryOperation_Negative>(), Info<UnaryOpResult<T, kUnaryOperation_Negative>>().index, kUnaryOperation_Negative, FromParameterList<T>());
 		else if constexpr (Op == kUnaryOperation_BitwiseNot)
-			return AddUnaryOp(Info<T>(), FromBitwiseNot<T>(), kUnaryOperation_BitwiseNot, FromParameterList<T>());
+			return AddUnaryOp(Info<T>(), FromBitwiseNot<T>(), FromUnaryOpInto<T, kUnaryOperation_BitwiseNot>(), Info<UnaryOpResult<T, kUnaryOperation_BitwiseNot>>().index, kUnaryOperation_BitwiseNot, FromParameterList<T>());
 		else if constexpr (Op == kUnaryOperation_LogicalNot)
-			return AddUnaryOp(Info<T>(), FromLogicalNot<T>(), kUnaryOperation_LogicalNot, FromParameterList<const T&>());
+			return AddUnaryOp(Info<T>(), FromLogicalNot<T>(), FromUnaryOpInto<T, kUnaryOperation_LogicalNot>(), Info<UnaryOpResult<T, kUnaryOperation_LogicalNot>>().index, kUnaryOperation_LogicalNot, FromParameterList<const T&>());
 		else
 			return false;
 	}
@@ -1428,49 +2160,49 @@ namespace Meta
 		static_assert(Op >= kBinaryOperation_Initial && Op < kComparisonOperation_Initial, "Not a valid binary operator!");
 
 		if constexpr (Op == kBinaryOperation_AddEquals)
-			return AddBinaryOp(Info<T>(), FromAddEquals<T, U>(), kBinaryOperation_AddEquals, FromParameterList<T&, U>());
+			return AddBinaryOp(Info<T>(), FromAddEquals<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_AddEquals>(), Info<BinaryOpResult<T, U, kBinaryOperation_AddEquals>>().index, kBinaryOperation_AddEquals, FromParameterList<T&, U>());
 		else if constexpr (Op == kBinaryOperation_SubEquals)
-			return AddBinaryOp(Info<T>(), FromSubEquals<T, U>(), kBinaryOperation_SubEquals, FromParameterList<T&, U>());
+			return AddBinaryOp(Info<T>(), FromSubEquals<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_SubEquals>(), Info<BinaryOpResult<T, U, kBinaryOperation_SubEquals>>().index, kBinaryOperation_SubEquals, FromParameterList<T&, U>());
 		else if constexpr (Op == kBinaryOperation_MulEquals)
-			return AddBinaryOp(Info<T>(), FromMulEquals<T, U>(), kBinaryOperation_MulEquals, FromParameterList<T&, U>());
+			return AddBinaryOp(Info<T>(), FromMulEquals<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_MulEquals>(), Info<BinaryOpResult<T, U, kBinaryOperation_MulEquals>>().index, kBinaryOperation_MulEquals, FromParameterList<T&, U>());
 		else if constexpr (Op == kBinaryOperation_DivEquals)
-			return AddBinaryOp(Info<T>(), FromDivEquals<T, U>(), kBinaryOperation_DivEquals, FromParameterList<T&, U>());
+			return AddBinaryOp(Info<T>(), FromDivEquals<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_DivEquals>(), Info<BinaryOpResult<T, U, kBinaryOperation_DivEquals>>().index, kBinaryOperation_DivEquals, FromParameterList<T&, U>());
 		else if constexpr (Op == kBinaryOperation_ModEquals)
-			return AddBinaryOp(Info<T>(), FromModEquals<T, U>(), kBinaryOperation_ModEquals, FromParameterList<T&, U>());
+			return AddBinaryOp(Info<T>(), FromModEquals<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_ModEquals>(), Info<BinaryOpResult<T, U, kBinaryOperation_ModEquals>>().index, kBinaryOperation_ModEquals, FromParameterList<T&, U>());
 		else if constexpr (Op == kBinaryOperation_BitwiseAndEquals)
-			return AddBinaryOp(Info<T>(), FromBitwiseAndEquals<T, U>(), kBinaryOperation_BitwiseAndEquals, FromParameterList<T&, U>());
+			return AddBinaryOp(Info<T>(), FromBitwiseAndEquals<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_BitwiseAndEquals>(), Info<BinaryOpResult<T, U, kBinaryOperation_BitwiseAndEquals>>().index, kBinaryOperation_BitwiseAndEquals, FromParameterList<T&, U>());
 		else if constexpr (Op == kBinaryOperation_BitwiseOrEquals)
-			return AddBinaryOp(Info<T>(), FromBitwiseOrEquals<T, U>(), kBinaryOperation_BitwiseOrEquals, FromParameterList<T&, U>());
+			return AddBinaryOp(Info<T>(), FromBitwiseOrEquals<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_BitwiseOrEquals>(), Info<BinaryOpResult<T, U, kBinaryOperation_BitwiseOrEquals>>().index, kBinaryOperation_BitwiseOrEquals, FromParameterList<T&, U>());
 		else if constexpr (Op == kBinaryOperation_BitwiseXorEquals)
-			return AddBinaryOp(Info<T>(), FromBitwiseXorEquals<T, U>(), kBinaryOperation_BitwiseXorEquals, FromParameterList<T&, U>());
+			return AddBinaryOp(Info<T>(), FromBitwiseXorEquals<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_BitwiseXorEquals>(), Info<BinaryOpResult<T, U, kBinaryOperation_BitwiseXorEquals>>().index, kBinaryOperation_BitwiseXorEquals, FromParameterList<T&, U>());
 		else if constexpr (Op == kBinaryOperation_BitwiseLeftShiftEquals)
-			return AddBinaryOp(Info<T>(), FromBitwiseLeftShiftEquals<T, U>(), kBinaryOperation_BitwiseLeftShiftEquals, FromParameterList<T&, U>());
+			return AddBinaryOp(Info<T>(), FromBitwiseLeftShiftEquals<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_BitwiseLeftShiftEquals>(), Info<BinaryOpResult<T, U, kBinaryOperation_BitwiseLeftShiftEquals>>().index, kBinaryOperation_BitwiseLeftShiftEquals, FromParameterList<T&, U>());
 		else if constexpr (Op == kBinaryOperation_BitwiseRightShiftEquals)
-			return AddBinaryOp(Info<T>(), FromBitwiseRightShiftEquals<T, U>(), kBinaryOperation_BitwiseRightShiftEquals, FromParameterList<T&, U>());
+			return AddBinaryOp(Info<T>(), FromBitwiseRightShiftEquals<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_BitwiseRightShiftEquals>(), Info<BinaryOpResult<T, U, kBinaryOperation_BitwiseRightShiftEquals>>().index, kBinaryOperation_BitwiseRightShiftEquals, FromParameterList<T&, U>());
 		else if constexpr (Op == kBinaryOperation_Add)
-			return AddBinaryOp(Info<T>(), FromAdd<T, U>(), kBinaryOperation_Add, FromParameterList<T, U>());
+			return AddBinaryOp(Info<T>(), FromAdd<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_Add>(), Info<BinaryOpResult<T, U, kBinaryOperation_Add>>().index, kBinaryOperation_Add, FromParameterList<T, U>());
 		else if constexpr (Op == kBinaryOperation_Sub)
-			return AddBinaryOp(Info<T>(), FromSub<T, U>(), kBinaryOperation_Sub, FromParameterList<T, U>());
+			return AddBinaryOp(Info<T>(), FromSub<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_Sub>(), Info<BinaryOpResult<T, U, kBinaryOperation_Sub>>().index, kBinaryOperation_Sub, FromParameterList<T, U>());
 		else if constexpr (Op == kBinaryOperation_Mul)
-			return AddBinaryOp(Info<T>(), FromMul<T, U>(), kBinaryOperation_Mul, FromParameterList<T, U>());
+			return AddBinaryOp(Info<T>(), FromMul<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_Mul>(), Info<BinaryOpResult<T, U, kBinaryOperation_Mul>>().index, kBinaryOperation_Mul, FromParameterList<T, U>());
 		else if constexpr (Op == kBinaryOperation_Div)
-			return AddBinaryOp(Info<T>(), FromDiv<T, U>(), kBinaryOperation_Div, FromParameterList<T, U>());
+			return AddBinaryOp(Info<T>(), FromDiv<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_Div>(), Info<BinaryOpResult<T, U, kBinaryOperation_Div>>().index, kBinaryOperation_Div, FromParameterList<T, U>());
 		else if constexpr (Op == kBinaryOperation_Mod)
-			return AddBinaryOp(Info<T>(), FromMod<T, U>(), kBinaryOperation_Mod, FromParameterList<T, U>());
+			return AddBinaryOp(Info<T>(), FromMod<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_Mod>(), Info<BinaryOpResult<T, U, kBinaryOperation_Mod>>().index, kBinaryOperation_Mod, FromParameterList<T, U>());
 		else if constexpr (Op == kBinaryOperation_BitwiseAnd)
-			return AddBinaryOp(Info<T>(), FromBitwiseAnd<T, U>(), kBinaryOperation_BitwiseAnd, FromParameterList<T, U>());
+			return AddBinaryOp(Info<T>(), FromBitwiseAnd<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_BitwiseAnd>(), Info<BinaryOpResult<T, U, kBinaryOperation_BitwiseAnd>>().index, kBinaryOperation_BitwiseAnd, FromParameterList<T, U>());
 		else if constexpr (Op == kBinaryOperation_BitwiseOr)
-			return AddBinaryOp(Info<T>(), FromBitwiseOr<T, U>(), kBinaryOperation_BitwiseOr, FromParameterList<T, U>());
+			return AddBinaryOp(Info<T>(), FromBitwiseOr<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_BitwiseOr>(), Info<BinaryOpResult<T, U, kBinaryOperation_BitwiseOr>>().index, kBinaryOperation_BitwiseOr, FromParameterList<T, U>());
 		else if constexpr (Op == kBinaryOperation_BitwiseXor)
-			return AddBinaryOp(Info<T>(), FromBitwiseXor<T, U>(), kBinaryOperation_BitwiseXor, FromParameterList<T, U>());
+			return AddBinaryOp(Info<T>(), FromBitwiseXor<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_BitwiseXor>(), Info<BinaryOpResult<T, U, kBinaryOperation_BitwiseXor>>().index, kBinaryOperation_BitwiseXor, FromParameterList<T, U>());
 		else if constexpr (Op == kBinaryOperation_BitwiseLeftShift)
-			return AddBinaryOp(Info<T>(), FromBitwiseLeftShift<T, U>(), kBinaryOperation_BitwiseLeftShift, FromParameterList<T, U>());
+			return AddBinaryOp(Info<T>(), FromBitwiseLeftShift<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_BitwiseLeftShift>(), Info<BinaryOpResult<T, U, kBinaryOperation_BitwiseLeftShift>>().index, kBinaryOperation_BitwiseLeftShift, FromParameterList<T, U>());
 		else if constexpr (Op == kBinaryOperation_BitwiseRightShift)
-			return AddBinaryOp(Info<T>(), FromBitwiseRightShift<T, U>(), kBinaryOperation_BitwiseRightShift, FromParameterList<T, U>());
+			return AddBinaryOp(Info<T>(), FromBitwiseRightShift<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_BitwiseRightShift>(), Info<BinaryOpResult<T, U, kBinaryOperation_BitwiseRightShift>>().index, kBinaryOperation_BitwiseRightShift, FromParameterList<T, U>());
 		else if constexpr (Op == kBinaryOperation_LogicalAnd)
-			return AddBinaryOp(Info<T>(), FromLogicalAnd<T, U>(), kBinaryOperation_LogicalAnd, FromParameterList<const T&, const U&>());
+			return AddBinaryOp(Info<T>(), FromLogicalAnd<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_LogicalAnd>(), Info<BinaryOpResult<T, U, kBinaryOperation_LogicalAnd>>().index, kBinaryOperation_LogicalAnd, FromParameterList<const T&, const U&>());
 		else if constexpr (Op == kBinaryOperation_LogicalOr)
-			return AddBinaryOp(Info<T>(), FromLogicalOr<T, U>(), kBinaryOperation_LogicalOr, FromParameterList<const T&, const U&>());
+			return AddBinaryOp(Info<T>(), FromLogicalOr<T, U>(), FromBinaryOpInto<T, U, kBinaryOperation_LogicalOr>(), Info<BinaryOpResult<T, U, kBinaryOperation_LogicalOr>>().index, kBinaryOperation_LogicalOr, FromParameterList<const T&, const U&>());
 		else
 			return false;
 	}
@@ -1519,17 +2251,17 @@ namespace Meta
 		static_assert(Op >= kComparisonOperation_Initial && Op <= kComparisonOperation_Final, "Not a valid comparison operator!");
 
 		if constexpr (Op == kComparisonOperation_Equals)
-			return AddBinaryOp(Info<T>(), FromEquals<T>(), kComparisonOperation_Equals, FromParameterList<const T&, const T&>());
+			return AddBinaryOp(Info<T>(), FromEquals<T>(), FromBinaryOpInto<T, T, kComparisonOperation_Equals>(), Info<BinaryOpResult<T, T, kComparisonOperation_Equals>>().index, kComparisonOperation_Equals, FromParameterList<const T&, const T&>());
 		else if constexpr (Op == kComparisonOperation_NotEquals)
-			return AddBinaryOp(Info<T>(), FromNotEquals<T>(), kComparisonOperation_NotEquals, FromParameterList<const T&, const T&>());
+			return AddBinaryOp(Info<T>(), FromNotEquals<T>(), FromBinaryOpInto<T, T, kComparisonOperation_NotEquals>(), Info<BinaryOpResult<T, T, kComparisonOperation_NotEquals>>().index, kComparisonOperation_NotEquals, FromParameterList<const T&, const T&>());
 		else if constexpr (Op == kComparisonOperation_LessThan)
-			return AddBinaryOp(Info<T>(), FromLessThan<T>(), kComparisonOperation_LessThan, FromParameterList<const T&, const T&>());
+			return AddBinaryOp(Info<T>(), FromLessThan<T>(), FromBinaryOpInto<T, T, kComparisonOperation_LessThan>(), Info<BinaryOpResult<T, T, kComparisonOperation_LessThan>>().index, kComparisonOperation_LessThan, FromParameterList<const T&, const T&>());
 		else if constexpr (Op == kComparisonOperation_LessThanOrEquals)
-			return AddBinaryOp(Info<T>(), FromLessThanOrEquals<T>(), kComparisonOperation_LessThanOrEquals, FromParameterList<const T&, const T&>());
+			return AddBinaryOp(Info<T>(), FromLessThanOrEquals<T>(), FromBinaryOpInto<T, T, kComparisonOperation_LessThanOrEquals>(), Info<BinaryOpResult<T, T, kComparisonOperation_LessThanOrEquals>>().index, kComparisonOperation_LessThanOrEquals, FromParameterList<const T&, const T&>());
 		else if constexpr (Op == kComparisonOperation_GreaterThan)
-			return AddBinaryOp(Info<T>(), FromGreaterThan<T>(), kComparisonOperation_GreaterThan, FromParameterList<const T&, const T&>());
+			return AddBinaryOp(Info<T>(), FromGreaterThan<T>(), FromBinaryOpInto<T, T, kComparisonOperation_GreaterThan>(), Info<BinaryOpResult<T, T, kComparisonOperation_GreaterThan>>().index, kComparisonOperation_GreaterThan, FromParameterList<const T&, const T&>());
 		else if constexpr (Op == kComparisonOperation_GreaterThanOrEquals)
-			return AddBinaryOp(Info<T>(), FromGreaterThanOrEquals<T>(), kComparisonOperation_GreaterThanOrEquals, FromParameterList<const T&, const T&>());
+			return AddBinaryOp(Info<T>(), FromGreaterThanOrEquals<T>(), FromBinaryOpInto<T, T, kComparisonOperation_GreaterThanOrEquals>(), Info<BinaryOpResult<T, T, kComparisonOperation_GreaterThanOrEquals>>().index, kComparisonOperation_GreaterThanOrEquals, FromParameterList<const T&, const T&>());
 		else
 			return false;
 	}
@@ -1545,10 +2277,339 @@ namespace Meta
 			&& AddComparisonOp<T, kComparisonOperation_GreaterThanOrEquals>();
 	}
 
+	// -----------------------------------------------------------------------------------------------------------------
+	// Expressions
+	// -----------------------------------------------------------------------------------------------------------------
+
+	// An input of an expression, referred to by name in its source
+	struct ExpressionParameter
+	{
+		Program::Name name;
+		Index type = kInvalidType;
+	};
+
+	// A formula over reflected values compiled once into bytecode. Names, fields, operators and the type of every
+	// intermediate value are resolved by Compile(), so run() is a loop over instructions that each call their own
+	// handler on a register file of Views, with temporaries on the stack.
+	//
+	// The source has parameters, integer, floating point and bool literals, fields reached with '.', parentheses and
+	// the non-assigning unary and binary C++ operators at C++ precedence. Operators are the Into forms registered for
+	// the operand types, except &&, || and ! on bools, which are built in and don't short-circuit. A literal takes the
+	// type of a primitive on the other side of its operator when it fits, and is otherwise i32 or f64.
+	// Why Compile() rejected a source
+	struct ExpressionError
+	{
+		std::size_t position = 0; // Into the source
+		const char* message = nullptr;
+	};
+
+	class Expression
+	{
+	public:
+		// Empty on syntax errors, unknown names and fields, operators that the operand types don't have and expressions
+		// too large to run, with the first of them in error when one is given
+		static std::optional<Expression> Compile(const std::wstring_view source, const std::span<const ExpressionParameter> parameters, ExpressionError* error = nullptr); // NOLINT(*-avoid-const-params-in-decls)
+
+		[[nodiscard]] Index get_result_type() const { return result_type; }
+
+		// One argument per parameter in declaration order, of exactly its type and readable as a mutable reference.
+		// The result is stored into destination as StoreResult() would.
+		void run(const View destination, const std::span<const View> arguments) const; // NOLINT(*-avoid-const-params-in-decls)
+
+	private:
+		struct Instruction;
+		using Handler = void (*)(const Instruction& instruction, View* registers);
+
+		struct Instruction
+		{
+			Handler handler = nullptr;
+
+			union
+			{
+				UnaryOperatorInto unary = nullptr;
+				BinaryOperatorInto binary;
+				Assigner assigner;
+				const Information* field;
+			};
+
+			std::size_t offset = 0; // Of a field inside its owner
+			u16 target = 0;
+			u16 lhs = 0;
+			u16 rhs = 0;
+		};
+
+		// Lives in the scratch space of run(), constructed before the first instruction and destroyed after the last
+		struct Temporary
+		{
+			const Information* info = nullptr;
+			std::size_t offset = 0;
+			Constructor constructor = nullptr; // Both null for primitives
+			Destructor destructor = nullptr;
+		};
+
+		// Registers are the destination, then the parameters, the constants and the temporaries
+		OS::Vector<Instruction> code;
+		OS::Vector<Index> parameter_types;
+		OS::Vector<View> constants;
+		OS::Vector<Temporary> temporaries;
+		std::size_t scratch_size = 0;
+		Index result_type = kInvalidType;
+
+		static void RunUnary(const Instruction& instruction, View* registers);
+		static void RunBinary(const Instruction& instruction, View* registers);
+		static void RunField(const Instruction& instruction, View* registers);
+		static void RunCopy(const Instruction& instruction, View* registers);
+		static void RunLogicalNot(const Instruction& instruction, View* registers);
+		static void RunLogicalAnd(const Instruction& instruction, View* registers);
+		static void RunLogicalOr(const Instruction& instruction, View* registers);
+
+		friend class ExpressionCompiler;
+	};
+
+	// -----------------------------------------------------------------------------------------------------------------
+	// Registration Profiling
+	// -----------------------------------------------------------------------------------------------------------------
+
+	enum ProfileCategory : u8
+	{
+		kProfile_Initializer,
+		kProfile_Register,
+		kProfile_Constructors,
+		kProfile_Destructors,
+		kProfile_Assigners,
+		kProfile_Methods,
+		kProfile_Fields,
+		kProfile_Operators,
+		kProfile_Inheritance,
+		kProfile_Conversions,
+		kProfile_Lazy,
+
+		kProfile_Count
+	};
+
+	struct ProfileMark
+	{
+		u64 nanoseconds = 0;
+		std::size_t allocations = 0;
+	};
+
+	// Both are no-ops unless kRegistrationProfiling is on
+	ProfileMark ProfileNow();
+	void AddProfile(const Index type, const ProfileCategory category, const ProfileMark& start); // NOLINT(*-avoid-const-params-in-decls)
+
+	// Slowest types first
+	void ReportRegistrationProfile();
+	bool SaveRegistrationProfile(const char* csv_path);
+
+	// -----------------------------------------------------------------------------------------------------------------
+	// Dispatch Profiling
+	// -----------------------------------------------------------------------------------------------------------------
+
+	enum DispatchOperation : u8
+	{
+		kDispatch_GetConstructor,
+		kDispatch_GetDestructor,
+		kDispatch_GetAssigner,
+		kDispatch_Construct,
+		kDispatch_Assign,
+		kDispatch_Invoke,
+		kDispatch_UnaryOperator,
+		kDispatch_BinaryOperator,
+
+		kDispatch_Count
+	};
+
+	// The Get*() lookups are only counted, since their callers make the call. Everything else is counted and sampled
+	// around both the lookup and the call.
+	struct DispatchProfile
+	{
+		Index type = kInvalidType;
+		Index other = kInvalidType; // Right-hand type of binary operators
+		Program::Name name; // Of invoked methods
+		DispatchOperation operation = kDispatch_Count;
+		u32 detail = 0; // Signature of the arguments, or the operator
+		u64 calls = 0;
+		u64 samples = 0;
+		u64 nanoseconds = 0; // Sum over the samples
+		std::array<u64, kDispatchHistogramBuckets> histogram = {}; // Samples by the bit width of their nanoseconds
+	};
+
+	// Every thread's counters merged, most calls first. Empty unless kDispatchProfiling is on.
+	OS::Vector<DispatchProfile> CollectDispatchProfile();
+
+	void ReportDispatchProfile(const std::size_t count = 20); // NOLINT(*-avoid-const-params-in-decls)
+	bool SaveDispatchProfile(const char* csv_path);
+
+	// -----------------------------------------------------------------------------------------------------------------
+	// Lazy Registration
+	// -----------------------------------------------------------------------------------------------------------------
+
+	using Populator = bool (*)();
+
+	// Runs the populator the first time the type's assigners or operators are looked up, or on Freeze(), instead of
+	// now. Runs it immediately when kLazyOperatorTables is off.
+	bool AddLazy(const Information& info, const Populator populator); // NOLINT(*-avoid-const-params-in-decls)
+
+	template<typename T, Populator Populate> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>>)
+	bool AddLazy()
+	{
+		return AddLazy(Info<T>(), Populate);
+	}
+
+	void ReportLazy();
+
+	// -----------------------------------------------------------------------------------------------------------------
+	// Registry Contexts
+	// -----------------------------------------------------------------------------------------------------------------
+
+	// Position of a type within a Registry, dense from 0 in the order types were added to it
+	using LocalIndex = Index;
+
+	struct RegistryState;
+
+	// A subsystem's own compact index space over the types it uses, with dense copies of their sizes, destructors,
+	// constructors and assigners. Types still register globally and Views keep global indices; a context only changes
+	// how much a loop over its types has to touch. The copies catch up with the registry on the first lookup after
+	// one of its own types changes, or for Global() after any type registers. Safe to use from any thread.
+	class Registry
+	{
+	public:
+		Registry();
+		Registry(const Registry&) = delete;
+		Registry(Registry&&) = delete;
+		~Registry();
+
+		Registry& operator=(const Registry&) = delete;
+		Registry& operator=(Registry&&) = delete;
+
+		// Every type, with local indices equal to global ones
+		static Registry& Global();
+
+		// Returns the existing local index if the type is already in the context
+		LocalIndex Add(const Information& info);
+
+		template<typename T> requires (std::is_same_v<T, std::remove_pointer_t<std::remove_cvref_t<T>>>)
+		LocalIndex Add()
+		{
+			return Add(Meta::Info<T>());
+		}
+
+		[[nodiscard]] std::size_t size() const;
+
+		// kInvalidType if the type isn't in the context
+		[[nodiscard]] LocalIndex Local(const Information& info) const;
+		[[nodiscard]] const Information& GetType(const LocalIndex local) const; // NOLINT(*-avoid-const-params-in-decls)
+
+		[[nodiscard]] std::size_t SizeOf(const LocalIndex local) const; // NOLINT(*-avoid-const-params-in-decls)
+		[[nodiscard]] std::size_t AlignmentOf(const LocalIndex local) const; // NOLINT(*-avoid-const-params-in-decls)
+		[[nodiscard]] Destructor GetDestructor(const LocalIndex local) const; // NOLINT(*-avoid-const-params-in-decls)
+		[[nodiscard]] Constructor GetConstructor(const LocalIndex local, const FunctionSignature signature) const; // NOLINT(*-avoid-const-params-in-decls)
+		[[nodiscard]] Assigner GetAssigner(const LocalIndex local, const FunctionSignature signature) const; // NOLINT(*-avoid-const-params-in-decls)
+		[[nodiscard]] Constructor GetConstructor(const LocalIndex local, const SignatureId signature) const; // NOLINT(*-avoid-const-params-in-decls)
+		[[nodiscard]] Assigner GetAssigner(const LocalIndex local, const SignatureId signature) const; // NOLINT(*-avoid-const-params-in-decls)
+
+	private:
+		explicit Registry(const bool everything); // NOLINT(*-avoid-const-params-in-decls)
+
+		std::unique_ptr<RegistryState> state;
+	};
+
+	// -----------------------------------------------------------------------------------------------------------------
+	// Modules
+	// -----------------------------------------------------------------------------------------------------------------
+
+	// Loads a shared library and owns every type its META_TYPE initializers register, as one unit. The executable
+	// must export its symbols for the library to link against (ENABLE_EXPORTS in CMake). kInvalidModule on failure.
+	ModuleId LoadModule(const char* path);
+
+	// Retires the module's types, drops every table entry of other types that points into the module, then closes it.
+	// Fails while frozen or while Handles of its types are alive. Retired indices stay valid and are never reused, but
+	// Find() no longer returns them and they have nothing left to dispatch to.
+	bool UnloadModule(const ModuleId module); // NOLINT(*-avoid-const-params-in-decls)
+
+	[[nodiscard]] bool IsRetired(const Information& info);
+
+	// -----------------------------------------------------------------------------------------------------------------
+	// Registry Statistics
+	// -----------------------------------------------------------------------------------------------------------------
+
+	struct TypeStats
+	{
+		Index type = kInvalidType;
+		Program::Name name;
+		std::size_t size = 0;
+
+		// Pool backing the type's Handles
+		std::size_t live_objects = 0;
+		std::size_t pool_slots = 0;
+		std::size_t pool_bytes = 0;
+
+		// Heap backing the type's Spandle lists. Fragmentation is 1 - largest free range / free slots.
+		std::size_t heap_live = 0;
+		std::size_t heap_slots = 0;
+		std::size_t heap_bytes = 0;
+		std::size_t heap_free_ranges = 0;
+		std::size_t heap_largest_free_range = 0;
+		double heap_fragmentation = 0.0;
+
+		std::size_t constructors = 0;
+		std::size_t assigners = 0;
+		std::size_t unary_ops = 0;
+		std::size_t binary_ops = 0;
+		std::size_t casters = 0;
+		std::size_t converters = 0;
+		std::size_t in_place_converters = 0; // The converters above that also have an in-place form for conversion plans
+
+		// Estimated bytes of the type's dispatch tables above
+		std::size_t table_bytes = 0;
+		bool lazy_pending = false;
+		bool retired = false;
+	};
+
+	struct TableStats
+	{
+		const char* name = "";
+		std::size_t entries = 0;
+		std::size_t buckets = 0;
+		std::size_t bytes = 0;
+		double load_factor = 0.0;
+	};
+
+	struct RegistryStats
+	{
+		std::size_t types = 0;
+		bool frozen = false;
+
+		std::size_t lazy_pending_types = 0;
+		std::size_t lazy_populated_types = 0;
+
+		OS::Memory::Stats memory;
+		OS::Vector<TableStats> tables;
+		OS::Vector<TypeStats> per_type;
+	};
+
+	enum StatsFormat : u8
+	{
+		kStatsFormat_Json,
+		kStatsFormat_Prometheus
+	};
+
+	// Taken under the registration lock. Pools and heaps aren't synchronized, so call it from the thread that owns the
+	// Handles like any other allocator access.
+	RegistryStats GetRegistryStats();
+	bool SaveRegistryStats(const char* path, const StatsFormat format); // NOLINT(*-avoid-const-params-in-decls)
+
 	// -----------------------------------------------------------------------------------------------------------------
 	// Registration Helpers
 	// -----------------------------------------------------------------------------------------------------------------
 
+	template<typename T>
+	bool AddPODAssigners()
+	{
+		return AddAssigner<T, const T&>()
+			&& AddAssigner<T, T&&>();
+	}
+
 	template<typename T>
 	bool AddPOD()
 	{
@@ -1556,27 +2617,38 @@ namespace Meta
 			&& AddConstructor<T, const T&>()
 			&& AddConstructor<T, T&&>()
 			&&  AddDestructor<T>()
-			&&    AddAssigner<T, const T&>()
-			&&    AddAssigner<T, T&&>();
+			&&      AddLazy<T, AddPODAssigners<T>>();
 	}
 
 	template<typename T>
-	bool AddPrimitiveIntegralType()
+	bool AddPrimitiveIntegralOps()
 	{
-		return AddPOD<T>()
-			&& AddAllUnaryOps<T>()
+		return AddAllUnaryOps<T>()
 			&& AddAllBinaryOps<T, T>()
 			&& AddAllComparisonOps<T>();
 	}
 
 	template<typename T>
-	bool AddPrimitiveFloatType()
+	bool AddPrimitiveFloatOps()
 	{
-		return AddPOD<T>()
-			&& AddAllFloatUnaryOps<T>()
+		return AddAllFloatUnaryOps<T>()
 			&& AddAllFloatMathOps<T, T>()
 			&& AddAllComparisonOps<T>();
 	}
+
+	template<typename T>
+	bool AddPrimitiveIntegralType()
+	{
+		return AddPOD<T>()
+			&& AddLazy<T, AddPrimitiveIntegralOps<T>>();
+	}
+
+	template<typename T>
+	bool AddPrimitiveFloatType()
+	{
+		return AddPOD<T>()
+			&& AddLazy<T, AddPrimitiveFloatOps<T>>();
+	}
 }
 
 #define NAMEOF_DEF(type) \
@@ -1597,14 +2669,18 @@ namespace Meta \
 { \
 	static const bool k##type##Success = []() -> bool \
 		{ \
+			const auto profile_start = Meta::ProfileNow(); \
 			const auto& info = Meta::Info<type>(); \
-			Program::Log::Std(L"Meta") << L"Registering " << info.name << L" as type index " << info.index <<  std::endl; \
+			Program::Log::Std(L"Meta") << L"Registering " << info.name << L" as type index " << info.index << L'\n'; \
 			using Type = std::remove_cvref_t<type>; \
 			bool result = Meta::RegistrationSuccessful(__VA_ARGS__); \
+			Meta::AddProfile(info.index, Meta::kProfile_Initializer, profile_start); \
 			return result; \
 		}(); \
 }
 
+#define META_FIELD(type, member) Meta::AddField<type, &type::member, decltype(type::member)>(Program::LiteralName(L###member), offsetof(type, member))
+
 #define META_TYPE_AS(type, alt_name, ...) using alt_name = type; META_TYPE(alt_name, __VA_ARGS__)
 
 #endif
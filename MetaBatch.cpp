@@ -0,0 +1,539 @@
+// MIT License
+//
+// Copyright (c) 2025 Entropy Embracers LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Meta.hpp"
+
+#if MK_IS_ARCH_X86
+	#include <immintrin.h>
+
+	#if defined(_MSC_VER) && !defined(__clang__)
+		#include <intrin.h>
+	#endif
+#endif
+
+// MSVC takes any intrinsic anywhere; GCC and Clang need the instruction set named on the function using it
+#if MK_IS_ARCH_X86 && (defined(__GNUC__) || defined(__clang__))
+	#define MK_TARGET_SSE2 __attribute__((target("sse2")))
+	#define MK_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+	#define MK_TARGET_SSE2
+	#define MK_TARGET_AVX2
+#endif
+
+namespace Meta
+{
+	using BatchKernel = void (*)(const void*, const void*, void*, std::size_t);
+
+	// Mirrors the From*() operator lambdas, narrowed back to the element type like FromAdd's T(...) conversion
+	template<typename T, BinaryOperation Operation>
+	static auto ScalarOp(const T a, const T b)
+	{
+		if constexpr (Operation == kBinaryOperation_Add)                           return T(a + b);
+		else if constexpr (Operation == kBinaryOperation_Sub)                      return T(a - b);
+		else if constexpr (Operation == kBinaryOperation_Mul)                      return T(a * b);
+		else if constexpr (Operation == kBinaryOperation_Div)                      return T(a / b);
+		else if constexpr (Operation == kBinaryOperation_Mod)                      return T(a % b);
+		else if constexpr (Operation == kBinaryOperation_BitwiseAnd)               return T(a & b);
+		else if constexpr (Operation == kBinaryOperation_BitwiseOr)                return T(a | b);
+		else if constexpr (Operation == kBinaryOperation_BitwiseXor)               return T(a ^ b);
+		else if constexpr (Operation == kBinaryOperation_BitwiseLeftShift)         return T(a << b);
+		else if constexpr (Operation == kBinaryOperation_BitwiseRightShift)        return T(a >> b);
+		else if constexpr (Operation == kBinaryOperation_LogicalAnd)               return bool(a && b);
+		else if constexpr (Operation == kBinaryOperation_LogicalOr)                return bool(a || b);
+		else if constexpr (Operation == kComparisonOperation_Equals)               return bool(a == b);
+		else if constexpr (Operation == kComparisonOperation_NotEquals)            return bool(a != b);
+		else if constexpr (Operation == kComparisonOperation_LessThan)             return bool(a < b);
+		else if constexpr (Operation == kComparisonOperation_LessThanOrEquals)     return bool(a <= b);
+		else if constexpr (Operation == kComparisonOperation_GreaterThan)          return bool(a > b);
+		else                                                                       return bool(a >= b);
+	}
+
+	template<typename T, BinaryOperation Operation>
+	static constexpr bool HasScalarOp()
+	{
+		if constexpr (Operation == kBinaryOperation_Mod)                    return requires(const T a, const T b) { a % b; };
+		else if constexpr (Operation == kBinaryOperation_BitwiseAnd)        return requires(const T a, const T b) { a & b; };
+		else if constexpr (Operation == kBinaryOperation_BitwiseOr)         return requires(const T a, const T b) { a | b; };
+		else if constexpr (Operation == kBinaryOperation_BitwiseXor)        return requires(const T a, const T b) { a ^ b; };
+		else if constexpr (Operation == kBinaryOperation_BitwiseLeftShift)  return requires(const T a, const T b) { a << b; };
+		else if constexpr (Operation == kBinaryOperation_BitwiseRightShift) return requires(const T a, const T b) { a >> b; };
+		else                                                                return true;
+	}
+
+	template<typename T, BinaryOperation Operation>
+	static void ScalarKernel(const void* lhs, const void* rhs, void* out, const std::size_t count)
+	{
+		using Result = decltype(ScalarOp<T, Operation>(T(), T()));
+
+		const T* a = static_cast<const T*>(lhs);
+		const T* b = static_cast<const T*>(rhs);
+		Result* result = static_cast<Result*>(out);
+
+		for (std::size_t i = 0; i < count; ++i)
+			result[i] = ScalarOp<T, Operation>(a[i], b[i]);
+	}
+
+#if MK_IS_ARCH_X86
+	// Each lane set is a load, a store, the arithmetic it has instructions for and a compare returning one bit per lane
+
+	struct Sse2F32
+	{
+		using Scalar = f32;
+		using Vector = __m128;
+		static constexpr std::size_t kLanes = 4;
+
+		template<BinaryOperation Operation>
+		static constexpr bool kSupports = Operation == kBinaryOperation_Add || Operation == kBinaryOperation_Sub
+			|| Operation == kBinaryOperation_Mul || Operation == kBinaryOperation_Div || IsBooleanResult(Operation);
+
+		MK_TARGET_SSE2 static Vector Load(const Scalar* values) { return _mm_loadu_ps(values); }
+		MK_TARGET_SSE2 static void Store(Scalar* values, const Vector vector) { _mm_storeu_ps(values, vector); }
+
+		template<BinaryOperation Operation>
+		MK_TARGET_SSE2 static Vector Arithmetic(const Vector a, const Vector b)
+		{
+			if constexpr (Operation == kBinaryOperation_Add)      return _mm_add_ps(a, b);
+			else if constexpr (Operation == kBinaryOperation_Sub) return _mm_sub_ps(a, b);
+			else if constexpr (Operation == kBinaryOperation_Mul) return _mm_mul_ps(a, b);
+			else                                                  return _mm_div_ps(a, b);
+		}
+
+		template<BinaryOperation Operation>
+		MK_TARGET_SSE2 static int Compare(const Vector a, const Vector b)
+		{
+			const Vector zero = _mm_setzero_ps();
+
+			if constexpr (Operation == kBinaryOperation_LogicalAnd)                    return _mm_movemask_ps(_mm_and_ps(_mm_cmpneq_ps(a, zero), _mm_cmpneq_ps(b, zero)));
+			else if constexpr (Operation == kBinaryOperation_LogicalOr)                return _mm_movemask_ps(_mm_or_ps(_mm_cmpneq_ps(a, zero), _mm_cmpneq_ps(b, zero)));
+			else if constexpr (Operation == kComparisonOperation_Equals)               return _mm_movemask_ps(_mm_cmpeq_ps(a, b));
+			else if constexpr (Operation == kComparisonOperation_NotEquals)            return _mm_movemask_ps(_mm_cmpneq_ps(a, b));
+			else if constexpr (Operation == kComparisonOperation_LessThan)             return _mm_movemask_ps(_mm_cmplt_ps(a, b));
+			else if constexpr (Operation == kComparisonOperation_LessThanOrEquals)     return _mm_movemask_ps(_mm_cmple_ps(a, b));
+			else if constexpr (Operation == kComparisonOperation_GreaterThan)          return _mm_movemask_ps(_mm_cmpgt_ps(a, b));
+			else                                                                       return _mm_movemask_ps(_mm_cmpge_ps(a, b));
+		}
+	};
+
+	struct Sse2F64
+	{
+		using Scalar = f64;
+		using Vector = __m128d;
+		static constexpr std::size_t kLanes = 2;
+
+		template<BinaryOperation Operation>
+		static constexpr bool kSupports = Sse2F32::kSupports<Operation>;
+
+		MK_TARGET_SSE2 static Vector Load(const Scalar* values) { return _mm_loadu_pd(values); }
+		MK_TARGET_SSE2 static void Store(Scalar* values, const Vector vector) { _mm_storeu_pd(values, vector); }
+
+		template<BinaryOperation Operation>
+		MK_TARGET_SSE2 static Vector Arithmetic(const Vector a, const Vector b)
+		{
+			if constexpr (Operation == kBinaryOperation_Add)      return _mm_add_pd(a, b);
+			else if constexpr (Operation == kBinaryOperation_Sub) return _mm_sub_pd(a, b);
+			else if constexpr (Operation == kBinaryOperation_Mul) return _mm_mul_pd(a, b);
+			else                                                  return _mm_div_pd(a, b);
+		}
+
+		template<BinaryOperation Operation>
+		MK_TARGET_SSE2 static int Compare(const Vector a, const Vector b)
+		{
+			const Vector zero = _mm_setzero_pd();
+
+			if constexpr (Operation == kBinaryOperation_LogicalAnd)                    return _mm_movemask_pd(_mm_and_pd(_mm_cmpneq_pd(a, zero), _mm_cmpneq_pd(b, zero)));
+			else if constexpr (Operation == kBinaryOperation_LogicalOr)                return _mm_movemask_pd(_mm_or_pd(_mm_cmpneq_pd(a, zero), _mm_cmpneq_pd(b, zero)));
+			else if constexpr (Operation == kComparisonOperation_Equals)               return _mm_movemask_pd(_mm_cmpeq_pd(a, b));
+			else if constexpr (Operation == kComparisonOperation_NotEquals)            return _mm_movemask_pd(_mm_cmpneq_pd(a, b));
+			else if constexpr (Operation == kComparisonOperation_LessThan)             return _mm_movemask_pd(_mm_cmplt_pd(a, b));
+			else if constexpr (Operation == kComparisonOperation_LessThanOrEquals)     return _mm_movemask_pd(_mm_cmple_pd(a, b));
+			else if constexpr (Operation == kComparisonOperation_GreaterThan)          return _mm_movemask_pd(_mm_cmpgt_pd(a, b));
+			else                                                                       return _mm_movemask_pd(_mm_cmpge_pd(a, b));
+		}
+	};
+
+	struct Sse2I32
+	{
+		using Scalar = i32;
+		using Vector = __m128i;
+		static constexpr std::size_t kLanes = 4;
+
+		// SSE2 has no 32-bit multiply that keeps the low halves, so Mul stays scalar here
+		template<BinaryOperation Operation>
+		static constexpr bool kSupports = Operation == kBinaryOperation_Add || Operation == kBinaryOperation_Sub
+			|| Operation == kBinaryOperation_BitwiseAnd || Operation == kBinaryOperation_BitwiseOr || Operation == kBinaryOperation_BitwiseXor
+			|| IsBooleanResult(Operation);
+
+		MK_TARGET_SSE2 static Vector Load(const Scalar* values) { return _mm_loadu_si128(reinterpret_cast<const Vector*>(values)); }
+		MK_TARGET_SSE2 static void Store(Scalar* values, const Vector vector) { _mm_storeu_si128(reinterpret_cast<Vector*>(values), vector); }
+
+		template<BinaryOperation Operation>
+		MK_TARGET_SSE2 static Vector Arithmetic(const Vector a, const Vector b)
+		{
+			if constexpr (Operation == kBinaryOperation_Add)             return _mm_add_epi32(a, b);
+			else if constexpr (Operation == kBinaryOperation_Sub)        return _mm_sub_epi32(a, b);
+			else if constexpr (Operation == kBinaryOperation_BitwiseAnd) return _mm_and_si128(a, b);
+			else if constexpr (Operation == kBinaryOperation_BitwiseOr)  return _mm_or_si128(a, b);
+			else                                                         return _mm_xor_si128(a, b);
+		}
+
+		MK_TARGET_SSE2 static int Mask(const Vector vector) { return _mm_movemask_ps(_mm_castsi128_ps(vector)); }
+
+		template<BinaryOperation Operation>
+		MK_TARGET_SSE2 static int Compare(const Vector a, const Vector b)
+		{
+			constexpr int kAll = (1 << kLanes) - 1;
+			const Vector zero = _mm_setzero_si128();
+
+			if constexpr (Operation == kBinaryOperation_LogicalAnd)                    return ~(Mask(_mm_cmpeq_epi32(a, zero)) | Mask(_mm_cmpeq_epi32(b, zero))) & kAll;
+			else if constexpr (Operation == kBinaryOperation_LogicalOr)                return ~(Mask(_mm_cmpeq_epi32(a, zero)) & Mask(_mm_cmpeq_epi32(b, zero))) & kAll;
+			else if constexpr (Operation == kComparisonOperation_Equals)               return Mask(_mm_cmpeq_epi32(a, b));
+			else if constexpr (Operation == kComparisonOperation_NotEquals)            return ~Mask(_mm_cmpeq_epi32(a, b)) & kAll;
+			else if constexpr (Operation == kComparisonOperation_LessThan)             return Mask(_mm_cmplt_epi32(a, b));
+			else if constexpr (Operation == kComparisonOperation_LessThanOrEquals)     return ~Mask(_mm_cmpgt_epi32(a, b)) & kAll;
+			else if constexpr (Operation == kComparisonOperation_GreaterThan)          return Mask(_mm_cmpgt_epi32(a, b));
+			else                                                                       return ~Mask(_mm_cmplt_epi32(a, b)) & kAll;
+		}
+	};
+
+	struct Avx2F32
+	{
+		using Scalar = f32;
+		using Vector = __m256;
+		static constexpr std::size_t kLanes = 8;
+
+		template<BinaryOperation Operation>
+		static constexpr bool kSupports = Sse2F32::kSupports<Operation>;
+
+		MK_TARGET_AVX2 static Vector Load(const Scalar* values) { return _mm256_loadu_ps(values); }
+		MK_TARGET_AVX2 static void Store(Scalar* values, const Vector vector) { _mm256_storeu_ps(values, vector); }
+
+		template<BinaryOperation Operation>
+		MK_TARGET_AVX2 static Vector Arithmetic(const Vector a, const Vector b)
+		{
+			if constexpr (Operation == kBinaryOperation_Add)      return _mm256_add_ps(a, b);
+			else if constexpr (Operation == kBinaryOperation_Sub) return _mm256_sub_ps(a, b);
+			else if constexpr (Operation == kBinaryOperation_Mul) return _mm256_mul_ps(a, b);
+			else                                                  return _mm256_div_ps(a, b);
+		}
+
+		template<BinaryOperation Operation>
+		MK_TARGET_AVX2 static int Compare(const Vector a, const Vector b)
+		{
+			const Vector zero = _mm256_setzero_ps();
+
+			if constexpr (Operation == kBinaryOperation_LogicalAnd)                    return _mm256_movemask_ps(_mm256_and_ps(_mm256_cmp_ps(a, zero, _CMP_NEQ_UQ), _mm256_cmp_ps(b, zero, _CMP_NEQ_UQ)));
+			else if constexpr (Operation == kBinaryOperation_LogicalOr)                return _mm256_movemask_ps(_mm256_or_ps(_mm256_cmp_ps(a, zero, _CMP_NEQ_UQ), _mm256_cmp_ps(b, zero, _CMP_NEQ_UQ)));
+			else if constexpr (Operation == kComparisonOperation_Equals)               return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+			else if constexpr (Operation == kComparisonOperation_NotEquals)            return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_NEQ_UQ));
+			else if constexpr (Operation == kComparisonOperation_LessThan)             return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LT_OQ));
+			else if constexpr (Operation == kComparisonOperation_LessThanOrEquals)     return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LE_OQ));
+			else if constexpr (Operation == kComparisonOperation_GreaterThan)          return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GT_OQ));
+			else                                                                       return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GE_OQ));
+		}
+	};
+
+	struct Avx2F64
+	{
+		using Scalar = f64;
+		using Vector = __m256d;
+		static constexpr std::size_t kLanes = 4;
+
+		template<BinaryOperation Operation>
+		static constexpr bool kSupports = Sse2F32::kSupports<Operation>;
+
+		MK_TARGET_AVX2 static Vector Load(const Scalar* values) { return _mm256_loadu_pd(values); }
+		MK_TARGET_AVX2 static void Store(Scalar* values, const Vector vector) { _mm256_storeu_pd(values, vector); }
+
+		template<BinaryOperation Operation>
+		MK_TARGET_AVX2 static Vector Arithmetic(const Vector a, const Vector b)
+		{
+			if constexpr (Operation == kBinaryOperation_Add)      return _mm256_add_pd(a, b);
+			else if constexpr (Operation == kBinaryOperation_Sub) return _mm256_sub_pd(a, b);
+			else if constexpr (Operation == kBinaryOperation_Mul) return _mm256_mul_pd(a, b);
+			else                                                  return _mm256_div_pd(a, b);
+		}
+
+		template<BinaryOperation Operation>
+		MK_TARGET_AVX2 static int Compare(const Vector a, const Vector b)
+		{
+			const Vector zero = _mm256_setzero_pd();
+
+			if constexpr (Operation == kBinaryOperation_LogicalAnd)                    return _mm256_movemask_pd(_mm256_and_pd(_mm256_cmp_pd(a, zero, _CMP_NEQ_UQ), _mm256_cmp_pd(b, zero, _CMP_NEQ_UQ)));
+			else if constexpr (Operation == kBinaryOperation_LogicalOr)                return _mm256_movemask_pd(_mm256_or_pd(_mm256_cmp_pd(a, zero, _CMP_NEQ_UQ), _mm256_cmp_pd(b, zero, _CMP_NEQ_UQ)));
+			else if constexpr (Operation == kComparisonOperation_Equals)               return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ));
+			else if constexpr (Operation == kComparisonOperation_NotEquals)            return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_NEQ_UQ));
+			else if constexpr (Operation == kComparisonOperation_LessThan)             return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_LT_OQ));
+			else if constexpr (Operation == kComparisonOperation_LessThanOrEquals)     return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_LE_OQ));
+			else if constexpr (Operation == kComparisonOperation_GreaterThan)          return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GT_OQ));
+			else                                                                       return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GE_OQ));
+		}
+	};
+
+	struct Avx2I32
+	{
+		using Scalar = i32;
+		using Vector = __m256i;
+		static constexpr std::size_t kLanes = 8;
+
+		template<BinaryOperation Operation>
+		static constexpr bool kSupports = Sse2I32::kSupports<Operation> || Operation == kBinaryOperation_Mul;
+
+		MK_TARGET_AVX2 static Vector Load(const Scalar* values) { return _mm256_loadu_si256(reinterpret_cast<const Vector*>(values)); }
+		MK_TARGET_AVX2 static void Store(Scalar* values, const Vector vector) { _mm256_storeu_si256(reinterpret_cast<Vector*>(values), vector); }
+
+		template<BinaryOperation Operation>
+		MK_TARGET_AVX2 static Vector Arithmetic(const Vector a, const Vector b)
+		{
+			if constexpr (Operation == kBinaryOperation_Add)             return _mm256_add_epi32(a, b);
+			else if constexpr (Operation == kBinaryOperation_Sub)        return _mm256_sub_epi32(a, b);
+			else if constexpr (Operation == kBinaryOperation_Mul)        return _mm256_mullo_epi32(a, b);
+			else if constexpr (Operation == kBinaryOperation_BitwiseAnd) return _mm256_and_si256(a, b);
+			else if constexpr (Operation == kBinaryOperation_BitwiseOr)  return _mm256_or_si256(a, b);
+			else                                                         return _mm256_xor_si256(a, b);
+		}
+
+		MK_TARGET_AVX2 static int Mask(const Vector vector) { return _mm256_movemask_ps(_mm256_castsi256_ps(vector)); }
+
+		template<BinaryOperation Operation>
+		MK_TARGET_AVX2 static int Compare(const Vector a, const Vector b)
+		{
+			constexpr int kAll = (1 << kLanes) - 1;
+			const Vector zero = _mm256_setzero_si256();
+
+			if constexpr (Operation == kBinaryOperation_LogicalAnd)                    return ~(Mask(_mm256_cmpeq_epi32(a, zero)) | Mask(_mm256_cmpeq_epi32(b, zero))) & kAll;
+			else if constexpr (Operation == kBinaryOperation_LogicalOr)                return ~(Mask(_mm256_cmpeq_epi32(a, zero)) & Mask(_mm256_cmpeq_epi32(b, zero))) & kAll;
+			else if constexpr (Operation == kComparisonOperation_Equals)               return Mask(_mm256_cmpeq_epi32(a, b));
+			else if constexpr (Operation == kComparisonOperation_NotEquals)            return ~Mask(_mm256_cmpeq_epi32(a, b)) & kAll;
+			else if constexpr (Operation == kComparisonOperation_LessThan)             return Mask(_mm256_cmpgt_epi32(b, a));
+			else if constexpr (Operation == kComparisonOperation_LessThanOrEquals)     return ~Mask(_mm256_cmpgt_epi32(a, b)) & kAll;
+			else if constexpr (Operation == kComparisonOperation_GreaterThan)          return Mask(_mm256_cmpgt_epi32(a, b));
+			else                                                                       return ~Mask(_mm256_cmpgt_epi32(b, a)) & kAll;
+		}
+	};
+
+	template<std::size_t Lanes>
+	static inline void StoreMask(bool* out, const int mask)
+	{
+		for (std::size_t lane = 0; lane < Lanes; ++lane)
+			out[lane] = ((mask >> lane) & 1) != 0;
+	}
+
+	template<typename Scalar, BinaryOperation Operation>
+	static inline void ScalarTail(const Scalar* a, const Scalar* b, void* out, const std::size_t i, const std::size_t count)
+	{
+		const std::size_t result_size = IsBooleanResult(Operation) ? sizeof(bool) : sizeof(Scalar);
+		ScalarKernel<Scalar, Operation>(a + i, b + i, static_cast<u8*>(out) + i * result_size, count - i);
+	}
+
+	// The loops are spelled out per instruction set since GCC won't inline target-specific intrinsics into a shared helper
+	template<typename Lanes, BinaryOperation Operation>
+	MK_TARGET_SSE2 static void Sse2Kernel(const void* lhs, const void* rhs, void* out, const std::size_t count)
+	{
+		using Scalar = typename Lanes::Scalar;
+
+		const Scalar* a = static_cast<const Scalar*>(lhs);
+		const Scalar* b = static_cast<const Scalar*>(rhs);
+		std::size_t i = 0;
+
+		for (; i + Lanes::kLanes <= count; i += Lanes::kLanes)
+		{
+			if constexpr (IsBooleanResult(Operation))
+				StoreMask<Lanes::kLanes>(static_cast<bool*>(out) + i, Lanes::template Compare<Operation>(Lanes::Load(a + i), Lanes::Load(b + i)));
+			else
+				Lanes::Store(static_cast<Scalar*>(out) + i, Lanes::template Arithmetic<Operation>(Lanes::Load(a + i), Lanes::Load(b + i)));
+		}
+
+		ScalarTail<Scalar, Operation>(a, b, out, i, count);
+	}
+
+	template<typename Lanes, BinaryOperation Operation>
+	MK_TARGET_AVX2 static void Avx2Kernel(const void* lhs, const void* rhs, void* out, const std::size_t count)
+	{
+		using Scalar = typename Lanes::Scalar;
+
+		const Scalar* a = static_cast<const Scalar*>(lhs);
+		const Scalar* b = static_cast<const Scalar*>(rhs);
+		std::size_t i = 0;
+
+		for (; i + Lanes::kLanes <= count; i += Lanes::kLanes)
+		{
+			if constexpr (IsBooleanResult(Operation))
+				StoreMask<Lanes::kLanes>(static_cast<bool*>(out) + i, Lanes::template Compare<Operation>(Lanes::Load(a + i), Lanes::Load(b + i)));
+			else
+				Lanes::Store(static_cast<Scalar*>(out) + i, Lanes::template Arithmetic<Operation>(Lanes::Load(a + i), Lanes::Load(b + i)));
+		}
+
+		ScalarTail<Scalar, Operation>(a, b, out, i, count);
+	}
+
+	static bool HasAvx2()
+	{
+	#if defined(_MSC_VER) && !defined(__clang__)
+		int registers[4];
+
+		__cpuid(registers, 0);
+		if (registers[0] < 7)
+			return false;
+
+		// AVX needs the OS to save the upper register halves, which XGETBV reports
+		__cpuid(registers, 1);
+		if (!(registers[2] & (1 << 27)) || !(registers[2] & (1 << 28)) || (_xgetbv(0) & 6) != 6)
+			return false;
+
+		__cpuidex(registers, 7, 0);
+		return (registers[1] & (1 << 5)) != 0;
+	#else
+		return __builtin_cpu_supports("avx2");
+	#endif
+	}
+#endif
+
+	template<typename T, BinaryOperation Operation>
+	static BatchKernel SelectKernel()
+	{
+	#if MK_IS_ARCH_X86
+		static const bool avx2 = HasAvx2();
+
+		if constexpr (std::is_same_v<T, f32>)
+		{
+			if constexpr (Avx2F32::kSupports<Operation>)
+				return avx2 ? &Avx2Kernel<Avx2F32, Operation> : &Sse2Kernel<Sse2F32, Operation>;
+		}
+		else if constexpr (std::is_same_v<T, f64>)
+		{
+			if constexpr (Avx2F64::kSupports<Operation>)
+				return avx2 ? &Avx2Kernel<Avx2F64, Operation> : &Sse2Kernel<Sse2F64, Operation>;
+		}
+		else if constexpr (std::is_same_v<T, i32>)
+		{
+			if constexpr (Sse2I32::kSupports<Operation>)
+				return avx2 ? &Avx2Kernel<Avx2I32, Operation> : &Sse2Kernel<Sse2I32, Operation>;
+			else if constexpr (Avx2I32::kSupports<Operation>)
+				return avx2 ? &Avx2Kernel<Avx2I32, Operation> : &ScalarKernel<T, Operation>;
+		}
+	#endif
+
+		if constexpr (HasScalarOp<T, Operation>())
+			return &ScalarKernel<T, Operation>;
+		else
+			return nullptr;
+	}
+
+	// Compound assignments are left out, so they have no kernel
+	template<typename T>
+	static BatchKernel SelectKernel(const BinaryOperation operation)
+	{
+		constexpr std::size_t kFirst = kBinaryOperation_Add;
+
+		if (operation < kFirst || operation >= kBinaryOperation_Count)
+			return nullptr;
+
+		return [&]<std::size_t... Operations>(std::index_sequence<Operations...>)
+		{
+			static const BatchKernel kernels[] = { SelectKernel<T, BinaryOperation(kFirst + Operations)>()... };
+			return kernels[operation - kFirst];
+		}(std::make_index_sequence<kBinaryOperation_Count - kFirst>());
+	}
+
+	static BatchKernel PrimitiveKernel(const BinaryOperation operation, const Index type)
+	{
+		if (type == Info<i32>().index) return SelectKernel<i32>(operation);
+		if (type == Info<f32>().index) return SelectKernel<f32>(operation);
+		if (type == Info<f64>().index) return SelectKernel<f64>(operation);
+		if (type == Info<u8>().index)  return SelectKernel<u8>(operation);
+		if (type == Info<u16>().index) return SelectKernel<u16>(operation);
+		if (type == Info<u32>().index) return SelectKernel<u32>(operation);
+		if (type == Info<u64>().index) return SelectKernel<u64>(operation);
+		if (type == Info<i8>().index)  return SelectKernel<i8>(operation);
+		if (type == Info<i16>().index) return SelectKernel<i16>(operation);
+		if (type == Info<i64>().index) return SelectKernel<i64>(operation);
+		if (type == Info<bool>().index) return SelectKernel<bool>(operation);
+
+		return nullptr;
+	}
+
+	void ApplyBatch(const BinaryOperation operation, const Information& info, const void* lhs, const void* rhs, void* out, const std::size_t count)
+	{
+		Program::Assert(operation >= kBinaryOperation_Add && operation < kBinaryOperation_Count, "Compound assignments aren't batched!");
+
+		// Same rule as Apply(): only operators the type registered
+		const BinaryOperator binary_operator = GetBinaryOp(info, operation, info);
+
+		if (const BatchKernel kernel = PrimitiveKernel(operation, info.index))
+		{
+			kernel(lhs, rhs, out, count);
+			return;
+		}
+
+		const u8* a = static_cast<const u8*>(lhs);
+		const u8* b = static_cast<const u8*>(rhs);
+		u8* result = static_cast<u8*>(out);
+
+		// Operands are viewed as plain references since by-value operators won't read through a const view; non-compound operators don't write them
+		if (IsBooleanResult(operation))
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const View view_a(const_cast<u8*>(a + i * info.size), info, kQualifier_Reference);
+				const View view_b(const_cast<u8*>(b + i * info.size), info, kQualifier_Reference);
+
+				reinterpret_cast<bool*>(result)[i] = binary_operator(view_a, view_b).as<bool>();
+			}
+
+			return;
+		}
+
+		const Constructor copy = GetConstructor(info, ExtendSignature(kEmptySignature, { info.index, kQualifier_Constant | kQualifier_Reference }));
+		Spandle arguments = Spandle::reserve(1);
+
+		// With an Into form each element is built once, as a copy of lhs, and the result stored into it without a Handle
+		if (const BinaryOperatorInto into = FindBinaryOpInto(info, operation, info))
+		{
+			Program::Assert(FindBinaryOpResult(info, operation, info) == info.index, "The operator doesn't compute the batch's type!");
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const View view_a(const_cast<u8*>(a + i * info.size), info, kQualifier_Reference);
+				const View view_b(const_cast<u8*>(b + i * info.size), info, kQualifier_Reference);
+				const View destination(result + i * info.size, info, kQualifier_Reference);
+
+				arguments[0] = Handle(View(view_a.internal(), info, kQualifier_Constant | kQualifier_Reference));
+				copy(destination, arguments);
+				into(destination, view_a, view_b);
+			}
+
+			return;
+		}
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const View view_a(const_cast<u8*>(a + i * info.size), info, kQualifier_Reference);
+			const View view_b(const_cast<u8*>(b + i * info.size), info, kQualifier_Reference);
+			const Handle value = binary_operator(view_a, view_b);
+
+			Program::Assert(value.peek().get_type() == info.index, "The operator doesn't compute the batch's type!");
+
+			arguments[0] = Handle(View(value.peek().internal(), info, kQualifier_Constant | kQualifier_Reference));
+			copy(View(result + i * info.size, info, kQualifier_Reference), arguments);
+		}
+	}
+}
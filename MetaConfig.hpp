@@ -26,6 +26,49 @@
 namespace Meta
 {
 	static constexpr std::size_t kPreallocationAmount = 32;
+
+	// Gives every C++ type a compile-time ID so View::is<T>() and Handle::is<T>() can confirm an exact type match with
+	// one integer compare instead of going through Info<T>() and the registry
+	static constexpr bool kCompileTimeTypeIds = true;
+
+	// Records time and allocations per type for Register(), every Add*() and each META_TYPE initializer, reported by
+	// ReportRegistrationProfile() and SaveRegistrationProfile()
+	static constexpr bool kRegistrationProfiling = false;
+
+	// Defers the tables registered through AddLazy() (operators and assigners of the built-in helpers) until a type is
+	// first dispatched on, which keeps them out of static initialization
+	static constexpr bool kLazyOperatorTables = true;
+
+	// Snapshot loaded while the primitives are bootstrapped, before any META_TYPE registers, if set. See LoadSnapshot().
+	static constexpr const char* kSnapshotPath = nullptr;
+
+	// Average number of names per displacement bucket in the perfect name table. Higher is smaller but slower to build.
+	static constexpr std::size_t kPerfectHashBucketSize = 4;
+
+	// Entries per DispatchCache: one is a monomorphic call site, a few cover the usual polymorphic ones
+	static constexpr std::size_t kDispatchCacheWays = 4;
+
+	// Counts calls per (type, operation, signature) through the runtime Get*() lookups, Construct(), Assign(), Invoke()
+	// and the operator entry points, and times one call in kDispatchProfileSampleRate of each thread. Reported by
+	// ReportDispatchProfile() and SaveDispatchProfile().
+	static constexpr bool kDispatchProfiling = false;
+	static constexpr std::size_t kDispatchProfileSampleRate = 64;
+
+	// Distinct dispatches one thread can count before the rest are dropped, and latency buckets, the last of which
+	// takes everything slower than the others
+	static constexpr std::size_t kDispatchProfileSlots = 512;
+	static constexpr std::size_t kDispatchHistogramBuckets = 24;
+
+	// Most entries each thread keeps per memo of overload resolutions, cast paths and conversion plans. A full memo
+	// still answers every lookup, it just searches again for keys it has no room for.
+	static constexpr std::size_t kResolutionMemoEntries = 4096;
+
+	// Bytes of intermediate values one ConversionPlan can build on the stack
+	static constexpr std::size_t kConversionScratchBytes = 512;
+
+	// Most registers and bytes of temporaries one Expression may use, since Expression::run() keeps both on the stack
+	static constexpr std::size_t kExpressionRegisters = 64;
+	static constexpr std::size_t kExpressionScratchBytes = 1024;
 }
 
 #endif //METACONFIG_H
@@ -0,0 +1,664 @@
+// MIT License
+//
+// Copyright (c) 2025 Entropy Embracers LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Meta.hpp"
+
+#include <cwctype>
+#include <memory>
+#include <string>
+
+namespace Meta
+{
+	// Temporaries are laid out for any alignment up to this
+	static constexpr std::size_t kExpressionAlignment = 64;
+
+	// Temporaries are numbered apart from constants until compiling ends, since the constants are placed before them
+	static constexpr u16 kTemporaryRegister = 0x8000;
+
+	// What parsing a subexpression yields: a register, or a literal still waiting for the operator it meets to pick
+	// its type
+	struct ExpressionOperand
+	{
+		u16 reg = 0;
+		Index type = kInvalidType;
+		bool literal = false;
+		bool floating = false;
+		i64 integer = 0;
+		f64 number = 0;
+	};
+
+	struct ExpressionOperator
+	{
+		std::wstring_view token;
+		int precedence = 0;
+		BinaryOperation operation = kBinaryOperation_Count;
+	};
+
+	// Two-character tokens come first so they aren't read as their first character
+	static constexpr ExpressionOperator kExpressionOperators[] =
+	{
+		{ L"||", 1, kBinaryOperation_LogicalOr },
+		{ L"&&", 2, kBinaryOperation_LogicalAnd },
+		{ L"==", 6, kComparisonOperation_Equals },
+		{ L"!=", 6, kComparisonOperation_NotEquals },
+		{ L"<=", 7, kComparisonOperation_LessThanOrEquals },
+		{ L">=", 7, kComparisonOperation_GreaterThanOrEquals },
+		{ L"<<", 8, kBinaryOperation_BitwiseLeftShift },
+		{ L">>", 8, kBinaryOperation_BitwiseRightShift },
+		{ L"|",  3, kBinaryOperation_BitwiseOr },
+		{ L"^",  4, kBinaryOperation_BitwiseXor },
+		{ L"&",  5, kBinaryOperation_BitwiseAnd },
+		{ L"<",  7, kComparisonOperation_LessThan },
+		{ L">",  7, kComparisonOperation_GreaterThan },
+		{ L"+",  9, kBinaryOperation_Add },
+		{ L"-",  9, kBinaryOperation_Sub },
+		{ L"*", 10, kBinaryOperation_Mul },
+		{ L"/", 10, kBinaryOperation_Div },
+		{ L"%", 10, kBinaryOperation_Mod },
+	};
+
+	template<typename T>
+	static bool IsType(const Index type)
+	{
+		return type == Info<T>().index;
+	}
+
+	static bool IsPrimitiveType(const Index type)
+	{
+		return IsType<u8>(type) || IsType<u16>(type) || IsType<u32>(type) || IsType<u64>(type)
+			|| IsType<i8>(type) || IsType<i16>(type) || IsType<i32>(type) || IsType<i64>(type)
+			|| IsType<f32>(type) || IsType<f64>(type) || IsType<bool>(type);
+	}
+
+	template<typename T>
+	static bool MakeConstant(const Index type, const ExpressionOperand& literal, View& constant)
+	{
+		if (!IsType<T>(type))
+			return false;
+
+		constant = View(literal.floating ? T(literal.number) : T(literal.integer));
+		return true;
+	}
+
+	// Recursive descent straight into bytecode, one register per intermediate value
+	class ExpressionCompiler
+	{
+	public:
+		ExpressionCompiler(Expression& expression, const std::wstring_view source, const std::span<const ExpressionParameter> parameters, ExpressionError& error)
+			: expression(expression)
+			, source(source)
+			, parameters(parameters)
+			, error(error)
+		{}
+
+		bool compile()
+		{
+			for (const ExpressionParameter& parameter : parameters)
+			{
+				Program::Assert(Valid(parameter.type), "Expression parameter of an invalid type!");
+				expression.parameter_types.push_back(parameter.type);
+			}
+
+			ExpressionOperand result = parse_binary(0);
+
+			if (failed())
+				return false;
+
+			skip_space();
+
+			if (position != source.size())
+				return fail(position, "Unexpected text after the expression!");
+
+			materialize(result, kInvalidType);
+			expression.result_type = result.type;
+
+			// The last operation can store straight into the destination, unless its register is only a View of a field
+			const bool last_temporary = !expression.code.empty() && expression.code.back().target == result.reg
+				&& result.reg == (kTemporaryRegister | u16(expression.temporaries.size() - 1)) && expression.temporaries.back().info;
+
+			if (last_temporary)
+			{
+				expression.code.back().target = 0;
+				expression.scratch_size = expression.temporaries.back().offset;
+				expression.temporaries.pop_back();
+			}
+			else
+			{
+				const Information& info = *GetType(result.type);
+
+				Expression::Instruction copy = { .handler = &Expression::RunCopy, .lhs = result.reg };
+				copy.assigner = GetAssigner(info, ExtendSignature(kEmptySignature, { info.index, kQualifier_Constant | kQualifier_Reference }));
+				expression.code.push_back(copy);
+			}
+
+			const std::size_t first_temporary = 1 + expression.parameter_types.size() + expression.constants.size();
+
+			if (first_temporary + expression.temporaries.size() > kExpressionRegisters)
+				return fail(0, "Expression needs too many registers!");
+
+			const auto place = [&](u16& reg)
+			{
+				if (reg & kTemporaryRegister)
+					reg = u16(first_temporary + (reg & ~kTemporaryRegister));
+			};
+
+			for (Expression::Instruction& instruction : expression.code)
+			{
+				place(instruction.target);
+				place(instruction.lhs);
+				place(instruction.rhs);
+			}
+
+			return true;
+		}
+
+	private:
+		Expression& expression;
+		std::wstring_view source;
+		std::span<const ExpressionParameter> parameters;
+		ExpressionError& error;
+		std::size_t position = 0;
+
+		// Only the first error is kept, since parsing unwinds through every caller after it
+		bool fail(const std::size_t at, const char* message)
+		{
+			if (!failed())
+				error = { .position = at, .message = message };
+
+			return false;
+		}
+
+		[[nodiscard]] bool failed() const { return error.message != nullptr; }
+
+		void skip_space()
+		{
+			while (position < source.size() && std::iswspace(source[position]))
+				++position;
+		}
+
+		bool accept(const std::wstring_view token)
+		{
+			skip_space();
+
+			if (source.substr(position, token.size()) != token)
+				return false;
+
+			position += token.size();
+			return true;
+		}
+
+		std::wstring_view identifier()
+		{
+			skip_space();
+
+			const std::size_t start = position;
+
+			while (position < source.size() && (std::iswalnum(source[position]) || source[position] == L'_'))
+				++position;
+
+			if (position == start || std::iswdigit(source[start]))
+			{
+				fail(start, "Expected a name in the expression!");
+				return {};
+			}
+
+			return source.substr(start, position - start);
+		}
+
+		u16 add_temporary(const Index type)
+		{
+			Expression::Temporary temporary;
+
+			if (type != kInvalidType)
+			{
+				const Information& info = *GetType(type);
+
+				if (info.alignment > kExpressionAlignment)
+					fail(position, "Expression temporary is overaligned!");
+
+				temporary.info = &info;
+				temporary.offset = (expression.scratch_size + info.alignment - 1) / info.alignment * info.alignment;
+				expression.scratch_size = temporary.offset + info.size;
+
+				if (expression.scratch_size > kExpressionScratchBytes)
+					fail(position, "Expression temporaries don't fit in the scratch space!");
+
+				if (!IsPrimitiveType(type))
+				{
+					temporary.constructor = GetConstructor(info, kEmptySignature);
+					temporary.destructor = GetDestructor(info);
+				}
+			}
+
+			expression.temporaries.push_back(temporary);
+			return kTemporaryRegister | u16(expression.temporaries.size() - 1);
+		}
+
+		// Gives a literal its type and a constant register. An integer takes any primitive type it is hinted, a
+		// floating point number only a floating point one.
+		void materialize(ExpressionOperand& operand, const Index hint)
+		{
+			if (!operand.literal)
+				return;
+
+			Index type = operand.floating ? Info<f64>().index : (operand.integer == i64(i32(operand.integer)) ? Info<i32>().index : Info<i64>().index);
+
+			if (IsPrimitiveType(hint) && !IsType<bool>(hint) && (!operand.floating || IsType<f32>(hint) || IsType<f64>(hint)))
+				type = hint;
+
+			View constant;
+
+			const bool made = MakeConstant<u8>(type, operand, constant) || MakeConstant<u16>(type, operand, constant)
+				|| MakeConstant<u32>(type, operand, constant) || MakeConstant<u64>(type, operand, constant)
+				|| MakeConstant<i8>(type, operand, constant) || MakeConstant<i16>(type, operand, constant)
+				|| MakeConstant<i32>(type, operand, constant) || MakeConstant<i64>(type, operand, constant)
+				|| MakeConstant<f32>(type, operand, constant) || MakeConstant<f64>(type, operand, constant);
+
+			Program::Assert(made, "Could not make the literal a constant!");
+
+			operand.reg = constant_register(constant);
+			operand.type = type;
+			operand.literal = false;
+		}
+
+		u16 constant_register(const View& constant)
+		{
+			expression.constants.push_back(constant);
+			return u16(expression.parameter_types.size() + expression.constants.size());
+		}
+
+		ExpressionOperand emit_unary(const std::size_t at, const UnaryOperation operation, ExpressionOperand operand)
+		{
+			if (failed())
+				return {};
+
+			materialize(operand, kInvalidType);
+
+			ExpressionOperand result;
+			Expression::Instruction instruction = { .lhs = operand.reg };
+
+			if (operation == kUnaryOperation_LogicalNot && IsType<bool>(operand.type))
+			{
+				result.type = operand.type;
+				instruction.handler = &Expression::RunLogicalNot;
+			}
+			else
+			{
+				const Information& info = *GetType(operand.type);
+
+				result.type = FindUnaryOpResult(info, operation);
+				instruction.handler = &Expression::RunUnary;
+				instruction.unary = FindUnaryOpInto(info, operation);
+
+				if (!instruction.unary || !Valid(result.type))
+				{
+					fail(at, "No unary operator with an Into form for the operand's type!");
+					return {};
+				}
+			}
+
+			result.reg = instruction.target = add_temporary(result.type);
+			expression.code.push_back(instruction);
+			return result;
+		}
+
+		ExpressionOperand emit_binary(const std::size_t at, const BinaryOperation operation, ExpressionOperand lhs, ExpressionOperand rhs)
+		{
+			if (failed())
+				return {};
+
+			// Two literals meet as f64 if either is one, otherwise each takes the type of the other side
+			materialize(lhs, rhs.literal ? (rhs.floating ? Info<f64>().index : kInvalidType) : rhs.type);
+			materialize(rhs, lhs.type);
+
+			ExpressionOperand result;
+			Expression::Instruction instruction = { .lhs = lhs.reg, .rhs = rhs.reg };
+
+			if ((operation == kBinaryOperation_LogicalAnd || operation == kBinaryOperation_LogicalOr) && IsType<bool>(lhs.type) && IsType<bool>(rhs.type))
+			{
+				result.type = lhs.type;
+				instruction.handler = operation == kBinaryOperation_LogicalAnd ? &Expression::RunLogicalAnd : &Expression::RunLogicalOr;
+			}
+			else
+			{
+				const Information& info_lhs = *GetType(lhs.type);
+				const Information& info_rhs = *GetType(rhs.type);
+
+				result.type = FindBinaryOpResult(info_lhs, operation, info_rhs);
+				instruction.handler = &Expression::RunBinary;
+				instruction.binary = FindBinaryOpInto(info_lhs, operation, info_rhs);
+
+				if (!instruction.binary || !Valid(result.type))
+				{
+					fail(at, "No binary operator with an Into form for the operands' types!");
+					return {};
+				}
+			}
+
+			result.reg = instruction.target = add_temporary(result.type);
+			expression.code.push_back(instruction);
+			return result;
+		}
+
+		ExpressionOperand parse_binary(const int precedence)
+		{
+			ExpressionOperand lhs = parse_unary();
+
+			while (!failed())
+			{
+				skip_space();
+
+				const ExpressionOperator* found = nullptr;
+
+				for (const ExpressionOperator& candidate : kExpressionOperators)
+				{
+					if (source.substr(position, candidate.token.size()) == candidate.token)
+					{
+						found = &candidate;
+						break;
+					}
+				}
+
+				if (!found || found->precedence < precedence)
+					return lhs;
+
+				const std::size_t at = position;
+				position += found->token.size();
+
+				const ExpressionOperand rhs = parse_binary(found->precedence + 1);
+				lhs = emit_binary(at, found->operation, lhs, rhs);
+			}
+
+			return {};
+		}
+
+		ExpressionOperand parse_unary()
+		{
+			// Signs and complements of literals are folded
+			skip_space();
+			const std::size_t at = position;
+
+			if (accept(L"-"))
+			{
+				ExpressionOperand operand = parse_unary();
+
+				if (!operand.literal)
+					return emit_unary(at, kUnaryOperation_Negative, operand);
+
+				operand.integer = -operand.integer;
+				operand.number = -operand.number;
+				return operand;
+			}
+
+			if (accept(L"+"))
+			{
+				const ExpressionOperand operand = parse_unary();
+				return operand.literal ? operand : emit_unary(at, kUnaryOperation_Positive, operand);
+			}
+
+			if (accept(L"~"))
+			{
+				ExpressionOperand operand = parse_unary();
+
+				if (!operand.literal || operand.floating)
+					return emit_unary(at, kUnaryOperation_BitwiseNot, operand);
+
+				operand.integer = ~operand.integer;
+				return operand;
+			}
+
+			// Not to be confused with !=, which parse_binary() would have taken before getting here
+			if (accept(L"!"))
+				return emit_unary(at, kUnaryOperation_LogicalNot, parse_unary());
+
+			return parse_postfix();
+		}
+
+		ExpressionOperand parse_postfix()
+		{
+			ExpressionOperand operand = parse_primary();
+
+			while (!failed() && accept(L"."))
+			{
+				const std::size_t at = position;
+				const std::wstring_view name = identifier();
+
+				if (failed())
+					return {};
+
+				if (operand.literal)
+				{
+					fail(at, "Literals have no fields!");
+					return {};
+				}
+
+				const Field* field = FindField(*GetType(operand.type), Program::StringName(name.data(), name.size()));
+
+				if (!field)
+				{
+					fail(at, "No field by that name in the expression!");
+					return {};
+				}
+
+				Expression::Instruction instruction = { .handler = &Expression::RunField, .offset = field->offset, .lhs = operand.reg };
+				instruction.field = GetType(field->type);
+
+				operand.reg = instruction.target = add_temporary(kInvalidType);
+				operand.type = field->type;
+				expression.code.push_back(instruction);
+			}
+
+			return operand;
+		}
+
+		ExpressionOperand parse_primary()
+		{
+			if (accept(L"("))
+			{
+				const ExpressionOperand operand = parse_binary(0);
+
+				if (!failed() && !accept(L")"))
+					fail(position, "Expected ')' in the expression!");
+
+				return operand;
+			}
+
+			skip_space();
+
+			if (position == source.size())
+			{
+				fail(position, "Unexpected end of the expression!");
+				return {};
+			}
+
+			if (std::iswdigit(source[position]) || source[position] == L'.')
+				return parse_number();
+
+			const std::size_t at = position;
+			const std::wstring_view name = identifier();
+
+			if (failed())
+				return {};
+
+			if (name == L"true" || name == L"false")
+			{
+				ExpressionOperand operand;
+				operand.type = Info<bool>().index;
+				operand.reg = constant_register(View(name == L"true"));
+				return operand;
+			}
+
+			for (std::size_t parameter = 0; parameter < parameters.size(); ++parameter)
+			{
+				if (parameters[parameter].name == name)
+					return { .reg = u16(1 + parameter), .type = parameters[parameter].type };
+			}
+
+			fail(at, "Unknown name in the expression!");
+			return {};
+		}
+
+		ExpressionOperand parse_number()
+		{
+			// An e is a digit of a hexadecimal number rather than an exponent
+			const bool hexadecimal = source.substr(position, 2) == L"0x" || source.substr(position, 2) == L"0X";
+
+			std::size_t end = position;
+			bool floating = false;
+
+			while (end < source.size())
+			{
+				const wchar_t character = source[end];
+
+				if (character == L'.' || (!hexadecimal && (character == L'e' || character == L'E')))
+					floating = true;
+				else if ((character == L'-' || character == L'+') && (source[end - 1] == L'e' || source[end - 1] == L'E') && floating)
+					;
+				else if (!std::iswalnum(character))
+					break;
+
+				++end;
+			}
+
+			// The C library parsers want a terminated string
+			const std::wstring text(source.substr(position, end - position));
+			wchar_t* parsed = nullptr;
+
+			ExpressionOperand operand = { .literal = true, .floating = floating };
+
+			if (floating)
+				operand.number = std::wcstod(text.c_str(), &parsed);
+			else
+				operand.integer = i64(std::wcstoull(text.c_str(), &parsed, 0));
+
+			if (parsed != text.c_str() + text.size())
+			{
+				fail(position, "Malformed number in the expression!");
+				return {};
+			}
+
+			position = end;
+			return operand;
+		}
+	};
+
+	std::optional<Expression> Expression::Compile(const std::wstring_view source, const std::span<const ExpressionParameter> parameters, ExpressionError* error)
+	{
+		Expression expression;
+		ExpressionError local;
+		ExpressionError& reported = error ? *error : local;
+
+		reported = {};
+
+		if (!ExpressionCompiler(expression, source, parameters, reported).compile())
+			return std::nullopt;
+
+		return expression;
+	}
+
+	void Expression::run(const View destination, const std::span<const View> arguments) const
+	{
+		Program::Assert(arguments.size() == parameter_types.size(), "Mismatched argument number!");
+		Program::Assert(destination.get_type() == result_type && (destination.get_qualifiers() & (kQualifier_Temporary | kQualifier_Constant | kQualifier_Reference)) == kQualifier_Reference,
+			"Not a writable destination of the expression's type!");
+
+		// Left uninitialized, Views are trivially copyable and every register is written before it is read
+		alignas(View) std::byte register_storage[sizeof(View) * kExpressionRegisters];
+		alignas(kExpressionAlignment) std::byte scratch[kExpressionScratchBytes];
+
+		View* registers = reinterpret_cast<View*>(register_storage);
+		View* next = registers;
+
+		std::construct_at(next++, destination);
+
+		for (std::size_t argument = 0; argument < arguments.size(); ++argument)
+		{
+			Program::Assert(arguments[argument].get_type() == parameter_types[argument], "Argument of the wrong type!");
+			std::construct_at(next++, arguments[argument]);
+		}
+
+		next = std::uninitialized_copy(constants.begin(), constants.end(), next);
+
+		for (const Temporary& temporary : temporaries)
+		{
+			if (!temporary.info)
+			{
+				std::construct_at(next++);
+				continue;
+			}
+
+			const View view(scratch + temporary.offset, *temporary.info, kQualifier_Reference);
+
+			if (temporary.constructor)
+				temporary.constructor(view, ArgPack<0>());
+
+			std::construct_at(next++, view);
+		}
+
+		for (const Instruction& instruction : code)
+			instruction.handler(instruction, registers);
+
+		const std::size_t first_temporary = 1 + arguments.size() + constants.size();
+
+		for (std::size_t temporary = 0; temporary < temporaries.size(); ++temporary)
+		{
+			if (temporaries[temporary].destructor)
+				temporaries[temporary].destructor(registers[first_temporary + temporary]);
+		}
+	}
+
+	void Expression::RunUnary(const Instruction& instruction, View* registers)
+	{
+		instruction.unary(registers[instruction.target], registers[instruction.lhs]);
+	}
+
+	void Expression::RunBinary(const Instruction& instruction, View* registers)
+	{
+		instruction.binary(registers[instruction.target], registers[instruction.lhs], registers[instruction.rhs]);
+	}
+
+	// Operators only read their operands, so the field is viewed as a plain reference like the objects it came from
+	void Expression::RunField(const Instruction& instruction, View* registers)
+	{
+		registers[instruction.target] = View(static_cast<u8*>(registers[instruction.lhs].internal()) + instruction.offset, *instruction.field, kQualifier_Reference);
+	}
+
+	void Expression::RunCopy(const Instruction& instruction, View* registers)
+	{
+		instruction.assigner(registers[instruction.target], ArgPack(registers[instruction.lhs]));
+	}
+
+	void Expression::RunLogicalNot(const Instruction& instruction, View* registers)
+	{
+		*registers[instruction.target].object<bool>() = !*registers[instruction.lhs].object<bool>();
+	}
+
+	void Expression::RunLogicalAnd(const Instruction& instruction, View* registers)
+	{
+		*registers[instruction.target].object<bool>() = *registers[instruction.lhs].object<bool>() && *registers[instruction.rhs].object<bool>();
+	}
+
+	void Expression::RunLogicalOr(const Instruction& instruction, View* registers)
+	{
+		*registers[instruction.target].object<bool>() = *registers[instruction.lhs].object<bool>() || *registers[instruction.rhs].object<bool>();
+	}
+}
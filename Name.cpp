@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <mutex>
 #include <vector>
 #include "OS.hpp"
 #include "Program.hpp"
@@ -44,12 +45,18 @@ namespace
         };
     };
 
-    OS::Vector<wchar_t> name_pool;
+    // Interned names are views into the pool, so it grows by whole blocks and never moves what it stores
+    constexpr std::size_t kNamePoolBlockSize = 4096;
+    OS::Vector<OS::Vector<wchar_t>> name_pool;
     OS::TrieSet<Program::Name, NameKeymaker> name_set;
+
+    // Names are interned from type registration, which may happen on any thread
+    std::mutex name_mutex;
 }
 
 Program::Name Program::LiteralName(const wchar_t* literal)
 {
+    const std::lock_guard lock(name_mutex);
     const auto name = Name(literal);
     auto search = name_set.find(name);
 
@@ -65,17 +72,24 @@ Program::Name Program::LiteralName(const wchar_t* literal)
 
 Program::Name Program::StringName(const wchar_t* string, const std::size_t size)
 {
+    const std::lock_guard lock(name_mutex);
     auto name = Name(string, size);
     auto search = name_set.find(name);
 
     if (search == name_set.end())
     {
-        const size_t old_list_size = name_pool.size();
+        if (name_pool.empty() || name_pool.back().capacity() - name_pool.back().size() < size)
+        {
+            name_pool.emplace_back();
+            name_pool.back().reserve(std::max(kNamePoolBlockSize, size));
+        }
+
+        auto& block = name_pool.back();
+        const size_t old_block_size = block.size();
 
-        name_pool.resize(old_list_size + size);
-        std::copy_n(string, size, std::next(name_pool.begin(), old_list_size));
+        block.insert(block.end(), string, string + size);
 
-        name = Name(&(*std::next(name_pool.begin(), old_list_size)), size);
+        name = Name(block.data() + old_block_size, size);
 
         auto [iterator, success] = name_set.insert(name);
         Assert(success, "Could not store name!");
@@ -84,3 +98,9 @@ Program::Name Program::StringName(const wchar_t* string, const std::size_t size)
 
     return *search;
 }
+
+void Program::ForgetName(const Name name)
+{
+    const std::lock_guard lock(name_mutex);
+    name_set.erase(name);
+}
@@ -31,6 +31,10 @@ namespace Program
 
 	Name LiteralName(const wchar_t* literal);
 	Name StringName(const wchar_t* string, const std::size_t size);
+
+	// Drops the name from interning so storage it points into, like a literal in an unloaded library, can go away.
+	// Views already handed out are not affected.
+	void ForgetName(const Name name);
 }
 
 constexpr bool operator==(const Program::Name& a, const Program::Name& b) noexcept
@@ -22,13 +22,41 @@
 
 #include "OS.hpp"
 
+#include <atomic>
 #include <cstdlib>
+#include <filesystem>
 #include <format>
 #include "Program.hpp"
 
+#if MK_IS_PLATFORM_WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace
 {
-	OS::Memory::Stats stats;
+	// Allocations may come from any thread, so the counters are relaxed atomics
+	struct AtomicStats
+	{
+		std::atomic<std::size_t> cur_memory_used = 0;
+		std::atomic<std::size_t> max_memory_used = 0;
+
+		std::atomic<std::size_t> cur_alignment_waste = 0;
+		std::atomic<std::size_t> max_alignment_waste = 0;
+
+		std::atomic<std::size_t> untracked_reallocations = 0;
+
+		std::atomic<std::size_t> allocations = 0;
+	};
+
+	AtomicStats stats;
 
 	std::uintptr_t GetAlignmentPadding(const std::size_t alignment) noexcept
 	{
@@ -78,8 +106,8 @@ namespace
 			{
 				const std::size_t total_size = GetTotalAllocationSize(alignment, size, count);
 
-				stats.cur_alignment_waste += total_size - (size * count);
-				stats.max_alignment_waste += total_size - (size * count);
+				stats.cur_alignment_waste.fetch_add(total_size - (size * count), std::memory_order_relaxed);
+				stats.max_alignment_waste.fetch_add(total_size - (size * count), std::memory_order_relaxed);
 			}
 
 			return aligned_ptr;
@@ -100,7 +128,7 @@ namespace
 			const auto original_ptr = reinterpret_cast<void*>((reinterpret_cast<std::uintptr_t>(aligned_ptr) | unaligned_bits) - GetAlignmentPadding(alignment));
 
 			if (count_waste)
-				stats.cur_alignment_waste -= GetTotalAllocationSize(alignment, size, count) - (size * count);
+				stats.cur_alignment_waste.fetch_sub(GetTotalAllocationSize(alignment, size, count) - (size * count), std::memory_order_relaxed);
 
 			return original_ptr;
 		}
@@ -130,8 +158,9 @@ void* OS::Memory::Allocate(const std::size_t alignment, const std::size_t size,
 	void* ptr = std::malloc(total_size);
 	Program::Assert(ptr, "Failed to allocate memory!");
 
-	stats.cur_memory_used += total_size;
-	stats.max_memory_used += total_size;
+	stats.cur_memory_used.fetch_add(total_size, std::memory_order_relaxed);
+	stats.max_memory_used.fetch_add(total_size, std::memory_order_relaxed);
+	stats.allocations.fetch_add(1, std::memory_order_relaxed);
 
 	return Align(ptr, alignment, size, count, true);
 }
@@ -139,7 +168,10 @@ void* OS::Memory::Allocate(const std::size_t alignment, const std::size_t size,
 void* OS::Memory::Reallocate(void* ptr, const std::size_t alignment, const std::size_t size, std::size_t& old_count, const std::size_t new_count, const bool tracked) noexcept
 {
 	if (!ptr)
+	{
+		old_count = new_count;
 		return Allocate(alignment, size, new_count);
+	}
 
 	// No point in physically shrinking memory, we might use it later
 	if (new_count <= old_count)
@@ -155,18 +187,17 @@ void* OS::Memory::Reallocate(void* ptr, const std::size_t alignment, const std::
 	const size_t new_total_size = GetTotalAllocationSize(alignment, size, new_count);
 	void* new_ptr = std::realloc(old_ptr, new_total_size);
 
+	// realloc() already released the old block if it moved
 	Program::Assert(new_ptr, "Failed to reallocate memory!");
-
-	if (old_ptr != new_ptr)
-		Deallocate(old_ptr, alignment, size, old_count);
+	stats.allocations.fetch_add(1, std::memory_order_relaxed);
 
 	if (tracked) [[likely]]
 	{
-		stats.cur_memory_used += new_total_size - old_total_size;
-		stats.max_memory_used += new_total_size - old_total_size;
+		stats.cur_memory_used.fetch_add(new_total_size - old_total_size, std::memory_order_relaxed);
+		stats.max_memory_used.fetch_add(new_total_size - old_total_size, std::memory_order_relaxed);
 	}
 	else
-		++stats.untracked_reallocations;
+		stats.untracked_reallocations.fetch_add(1, std::memory_order_relaxed);
 
 	old_count = new_count;
 
@@ -178,22 +209,40 @@ void OS::Memory::Deallocate(void* ptr, const std::size_t alignment, const std::s
 	if (ptr)
 	{
 		std::free(Dealign(ptr, alignment, size, count, true));
-		stats.cur_memory_used -= GetTotalAllocationSize(alignment, size, count);
+		stats.cur_memory_used.fetch_sub(GetTotalAllocationSize(alignment, size, count), std::memory_order_relaxed);
 	}
 }
 
 void OS::Memory::Report()
 {
-	PrintMemoryStat(stats.cur_memory_used, L"Cur. Used Memory");
-	PrintMemoryStat(stats.max_memory_used, L"Max. Used Memory");
+	const Stats snapshot = GetStats();
+
+	PrintMemoryStat(snapshot.cur_memory_used, L"Cur. Used Memory");
+	PrintMemoryStat(snapshot.max_memory_used, L"Max. Used Memory");
 
-	PrintMemoryStat(stats.cur_alignment_waste, L"Cur. Alignment Waste");
-	PrintMemoryStat(stats.max_alignment_waste, L"Max. Alignment Waste");
+	PrintMemoryStat(snapshot.cur_alignment_waste, L"Cur. Alignment Waste");
+	PrintMemoryStat(snapshot.max_alignment_waste, L"Max. Alignment Waste");
 
-	Program::Log::Std(L"Memory") << L"Untracked Reallocations: " << stats.untracked_reallocations << std::endl;
+	Program::Log::Std(L"Memory") << L"Untracked Reallocations: " << snapshot.untracked_reallocations << std::endl;
+	Program::Log::Std(L"Memory") << L"Allocations: " << snapshot.allocations << std::endl;
 }
 
-OS::Memory::Stats OS::Memory::GetStats() noexcept { return stats; }
+OS::Memory::Stats OS::Memory::GetStats() noexcept
+{
+	Stats snapshot;
+
+	snapshot.cur_memory_used = stats.cur_memory_used.load(std::memory_order_relaxed);
+	snapshot.max_memory_used = stats.max_memory_used.load(std::memory_order_relaxed);
+
+	snapshot.cur_alignment_waste = stats.cur_alignment_waste.load(std::memory_order_relaxed);
+	snapshot.max_alignment_waste = stats.max_alignment_waste.load(std::memory_order_relaxed);
+
+	snapshot.untracked_reallocations = stats.untracked_reallocations.load(std::memory_order_relaxed);
+
+	snapshot.allocations = stats.allocations.load(std::memory_order_relaxed);
+
+	return snapshot;
+}
 
 void* OS::Memory::Simple::DirtyAllocate(const std::size_t size) noexcept { return Allocate(0, size, 1); }
 
@@ -211,3 +260,239 @@ void* OS::Memory::Simple::Reallocate(void* ptr, const std::size_t size) noexcept
 }
 
 void  OS::Memory::Simple::Deallocate(void* ptr, const std::size_t size) noexcept { return Memory::Deallocate(ptr, 0, size, 1); }
+
+OS::MappedFile::MappedFile(const char* path)
+{
+#if MK_IS_PLATFORM_WINDOWS
+	const HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (file == INVALID_HANDLE_VALUE)
+		return;
+
+	LARGE_INTEGER file_size;
+
+	if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0)
+	{
+		mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+		if (mapping)
+		{
+			bytes = static_cast<const std::byte*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+
+			if (bytes)
+				length = std::size_t(file_size.QuadPart);
+			else
+			{
+				CloseHandle(mapping);
+				mapping = nullptr;
+			}
+		}
+	}
+
+	CloseHandle(file);
+#else
+	const int file = open(path, O_RDONLY);
+
+	if (file < 0)
+		return;
+
+	struct stat file_stat = {};
+
+	if (fstat(file, &file_stat) == 0 && file_stat.st_size > 0)
+	{
+		void* view = mmap(nullptr, std::size_t(file_stat.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+
+		if (view != MAP_FAILED)
+		{
+			bytes = static_cast<const std::byte*>(view);
+			length = std::size_t(file_stat.st_size);
+		}
+	}
+
+	close(file);
+#endif
+}
+
+OS::MappedFile::MappedFile(MappedFile&& other) noexcept
+	: bytes(std::exchange(other.bytes, nullptr))
+	, length(std::exchange(other.length, 0))
+	, mapping(std::exchange(other.mapping, nullptr))
+{}
+
+OS::MappedFile::~MappedFile()
+{
+	unmap();
+}
+
+OS::MappedFile& OS::MappedFile::operator=(MappedFile&& other) noexcept
+{
+	if (this != &other)
+	{
+		unmap();
+
+		bytes = std::exchange(other.bytes, nullptr);
+		length = std::exchange(other.length, 0);
+		mapping = std::exchange(other.mapping, nullptr);
+	}
+
+	return *this;
+}
+
+void OS::MappedFile::unmap() noexcept
+{
+	if (!bytes)
+		return;
+
+#if MK_IS_PLATFORM_WINDOWS
+	UnmapViewOfFile(bytes);
+	CloseHandle(mapping);
+#else
+	munmap(const_cast<std::byte*>(bytes), length);
+#endif
+
+	bytes = nullptr;
+	length = 0;
+	mapping = nullptr;
+}
+
+OS::SharedLibrary::SharedLibrary(const char* path)
+{
+#if MK_IS_PLATFORM_WINDOWS
+	handle = LoadLibraryA(path);
+#else
+	std::error_code error;
+	const std::filesystem::path resolved = std::filesystem::canonical(path, error);
+
+	if (error)
+		return;
+
+	// Loading by canonical path makes it the name dladdr() reports for the library's addresses
+	image = resolved.string();
+	handle = dlopen(image.c_str(), RTLD_NOW | RTLD_LOCAL);
+
+	if (!handle)
+		image.clear();
+#endif
+}
+
+OS::SharedLibrary::SharedLibrary(SharedLibrary&& other) noexcept
+	: handle(std::exchange(other.handle, nullptr))
+	, image(std::move(other.image))
+{}
+
+OS::SharedLibrary::~SharedLibrary()
+{
+	close();
+}
+
+OS::SharedLibrary& OS::SharedLibrary::operator=(SharedLibrary&& other) noexcept
+{
+	if (this != &other)
+	{
+		close();
+
+		handle = std::exchange(other.handle, nullptr);
+		image = std::move(other.image);
+	}
+
+	return *this;
+}
+
+bool OS::SharedLibrary::contains(const void* address) const noexcept
+{
+	if (!handle || !address)
+		return false;
+
+#if MK_IS_PLATFORM_WINDOWS
+	HMODULE owner = nullptr;
+
+	if (!GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT, static_cast<LPCSTR>(address), &owner))
+		return false;
+
+	return owner == static_cast<HMODULE>(handle);
+#else
+	Dl_info info = {};
+	return dladdr(address, &info) != 0 && info.dli_fname && image == info.dli_fname;
+#endif
+}
+
+void OS::SharedLibrary::close() noexcept
+{
+	if (!handle)
+		return;
+
+#if MK_IS_PLATFORM_WINDOWS
+	FreeLibrary(static_cast<HMODULE>(handle));
+#else
+	dlclose(handle);
+#endif
+
+	handle = nullptr;
+	image.clear();
+}
+
+std::uint64_t OS::ExecutableFingerprint()
+{
+	std::filesystem::path executable;
+
+#if MK_IS_PLATFORM_WINDOWS
+	wchar_t module_path[MAX_PATH] = { 0 };
+
+	if (GetModuleFileNameW(nullptr, module_path, MAX_PATH) == 0)
+		return 0;
+
+	executable = module_path;
+#elif MK_IS_PLATFORM_LINUX || MK_IS_PLATFORM_ANDROID
+	executable = "/proc/self/exe";
+#else
+	return 0;
+#endif
+
+	std::error_code error;
+
+	const auto file_size = std::filesystem::file_size(executable, error);
+
+	if (error)
+		return 0;
+
+	const auto write_time = std::filesystem::last_write_time(executable, error);
+
+	if (error)
+		return 0;
+
+	// FNV-1a over the size and modification time
+	std::uint64_t fingerprint = 0xCBF29CE484222325ull;
+
+	for (const std::uint64_t part : { std::uint64_t(file_size), std::uint64_t(write_time.time_since_epoch().count()) })
+	{
+		for (std::size_t byte = 0; byte < sizeof(part); ++byte)
+		{
+			fingerprint ^= (part >> (byte * 8)) & 0xFF;
+			fingerprint *= 0x100000001B3ull;
+		}
+	}
+
+	return fingerprint == 0 ? 1 : fingerprint;
+}
+
+bool OS::PinThisThread(const std::size_t core)
+{
+#if MK_IS_PLATFORM_WINDOWS
+	if (core >= sizeof(DWORD_PTR) * 8)
+		return false;
+
+	return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << core) != 0;
+#elif MK_IS_PLATFORM_LINUX || MK_IS_PLATFORM_ANDROID
+	if (core >= CPU_SETSIZE)
+		return false;
+
+	cpu_set_t cores;
+	CPU_ZERO(&cores);
+	CPU_SET(core, &cores);
+
+	// On Linux a pid of 0 is the calling thread, not the whole process
+	return sched_setaffinity(0, sizeof(cores), &cores) == 0;
+#else
+	return false;
+#endif
+}
@@ -23,13 +23,18 @@
 #ifndef EXTROPY_OS_HPP
 #define EXTROPY_OS_HPP
 
+#include <atomic>
+#include <bit>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <map>
 #include <memory>
 #include <set>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 #include "patricia.hpp"
 
@@ -44,6 +49,8 @@ namespace OS::Memory
 		std::size_t max_alignment_waste = 0;
 
 		std::size_t untracked_reallocations = 0;
+
+		std::size_t allocations = 0;
 	};
 
 	[[nodiscard]] void* Allocate(const std::size_t alignment, const std::size_t size, const std::size_t count) noexcept;
@@ -147,6 +154,55 @@ namespace OS::Memory
 		friend constexpr bool operator==(const Allocator&, const Allocator&) noexcept { return true; }
 	};
 
+	static constexpr std::size_t kCacheLineSize = 64;
+
+	template<typename T>
+	struct CacheAlignedAllocator
+	{
+		using value_type                             = T;
+		using size_type                              = std::size_t;
+		using difference_type                        = std::ptrdiff_t;
+		using propagate_on_container_move_assignment = std::true_type;
+		using is_always_equal                        = std::true_type;
+
+		template <typename U>
+		struct rebind
+		{
+			using other = CacheAlignedAllocator<U>;
+		};
+
+		static constexpr std::size_t kTypeAlignment = alignof(T) > kCacheLineSize ? alignof(T) : kCacheLineSize;
+		static constexpr std::size_t kTypeSize      = sizeof(T);
+
+		constexpr CacheAlignedAllocator() noexcept = default;
+		constexpr CacheAlignedAllocator(const CacheAlignedAllocator&) noexcept : CacheAlignedAllocator() {}
+		constexpr CacheAlignedAllocator(CacheAlignedAllocator&&) noexcept : CacheAlignedAllocator() {}
+
+		template<typename U>
+		constexpr explicit CacheAlignedAllocator(const CacheAlignedAllocator<U>&) noexcept : CacheAlignedAllocator() {}
+		template<typename U>
+		constexpr explicit CacheAlignedAllocator(CacheAlignedAllocator<U>&) noexcept : CacheAlignedAllocator() {}
+		template<typename U>
+		constexpr explicit CacheAlignedAllocator(CacheAlignedAllocator<U>&&) noexcept : CacheAlignedAllocator() {}
+
+		constexpr ~CacheAlignedAllocator() noexcept = default;
+
+		constexpr CacheAlignedAllocator& operator=(const CacheAlignedAllocator&) noexcept = default;
+		constexpr CacheAlignedAllocator& operator=(CacheAlignedAllocator&&) noexcept      = default;
+
+		[[nodiscard]] static constexpr T* allocate(const std::size_t count) noexcept
+		{
+			return static_cast<T*>(Allocate(kTypeAlignment, kTypeSize, count));
+		}
+
+		static constexpr void deallocate(T* ptr, const std::size_t count) noexcept
+		{
+			Memory::Deallocate(ptr, kTypeAlignment, kTypeSize, count);
+		}
+
+		friend constexpr bool operator==(const CacheAlignedAllocator&, const CacheAlignedAllocator&) noexcept { return true; }
+	};
+
 	namespace Simple
 	{
 		void* DirtyAllocate(const std::size_t size) noexcept;
@@ -166,15 +222,100 @@ constexpr bool operator==(const OS::Memory::Allocator<T>&, const OS::Memory::All
 template<typename T, typename U>
 constexpr bool operator!=(const OS::Memory::Allocator<T>&, const OS::Memory::Allocator<U>&) noexcept { return false; }
 
+template<typename T, typename U>
+constexpr bool operator==(const OS::Memory::CacheAlignedAllocator<T>&, const OS::Memory::CacheAlignedAllocator<U>&) noexcept { return true; }
+template<typename T, typename U>
+constexpr bool operator!=(const OS::Memory::CacheAlignedAllocator<T>&, const OS::Memory::CacheAlignedAllocator<U>&) noexcept { return false; }
+
 namespace OS
 {
 	template<typename T>
 	using Vector = std::vector<T, Memory::Allocator<T>>;
 
+	// Backing storage starts on a cache line, for tables that are scanned or indexed on hot paths
+	template<typename T>
+	using CacheVector = std::vector<T, Memory::CacheAlignedAllocator<T>>;
+
 	// TODO: Is there a portable way to get the allocation type for a std::vector<bool>?
 	using BitType = unsigned long;
 	using BitVector = std::vector<bool, Memory::Allocator<BitType>>;
 
+	// Grows in power-of-two segments so elements never move once constructed. Appending must be serialized by the
+	// caller, but any element below size() may be read concurrently with an append without locking.
+	template<typename T>
+	class StableVector
+	{
+	public:
+		static constexpr std::size_t kFirstSegmentSize = 32;
+		static constexpr std::size_t kMaxSegments      = 40;
+
+		constexpr StableVector() noexcept = default;
+		StableVector(const StableVector&) = delete;
+		StableVector(StableVector&&) = delete;
+
+		~StableVector()
+		{
+			const std::size_t count = published.load(std::memory_order_relaxed);
+
+			for (std::size_t index = 0; index < count; ++index)
+				std::destroy_at(&(*this)[index]);
+
+			for (std::size_t segment = 0; segment < kMaxSegments; ++segment)
+				Memory::Deallocate(segments[segment].load(std::memory_order_relaxed), alignof(T), sizeof(T), SegmentSize(segment));
+		}
+
+		StableVector& operator=(const StableVector&) = delete;
+		StableVector& operator=(StableVector&&) = delete;
+
+		[[nodiscard]] std::size_t size() const noexcept { return published.load(std::memory_order_acquire); }
+		[[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+		T& operator[](const std::size_t index) noexcept
+		{
+			const auto [segment, offset] = Locate(index);
+			return segments[segment].load(std::memory_order_acquire)[offset];
+		}
+
+		const T& operator[](const std::size_t index) const noexcept
+		{
+			const auto [segment, offset] = Locate(index);
+			return segments[segment].load(std::memory_order_acquire)[offset];
+		}
+
+		// The element is fully constructed before it becomes visible through size()
+		template<typename... Args>
+		T& emplace_back(Args&&... args)
+		{
+			const std::size_t index = published.load(std::memory_order_relaxed);
+			const auto [segment, offset] = Locate(index);
+
+			T* storage = segments[segment].load(std::memory_order_relaxed);
+
+			if (!storage)
+			{
+				storage = static_cast<T*>(Memory::Allocate(alignof(T), sizeof(T), SegmentSize(segment)));
+				segments[segment].store(storage, std::memory_order_release);
+			}
+
+			T* element = std::construct_at(storage + offset, std::forward<Args>(args)...);
+			published.store(index + 1, std::memory_order_release);
+
+			return *element;
+		}
+
+	private:
+		static constexpr std::size_t SegmentSize(const std::size_t segment) noexcept { return kFirstSegmentSize << segment; }
+
+		static constexpr std::pair<std::size_t, std::size_t> Locate(const std::size_t index) noexcept
+		{
+			const std::size_t segment = std::size_t(std::bit_width(index / kFirstSegmentSize + 1)) - 1;
+			return { segment, index - (kFirstSegmentSize * ((std::size_t(1) << segment) - 1)) };
+		}
+
+		std::atomic<T*> segments[kMaxSegments] = {};
+		std::atomic<std::size_t> published = 0;
+	};
+
 	template<typename T>
 	using SortSet = std::set<T, Memory::Allocator<T>>;
 
@@ -192,6 +333,64 @@ namespace OS
 
 	template<typename K, typename V, typename KM = sk::patricia_key_maker<K>>
 	using TrieMap = sk::patricia_map<K, V, KM, Memory::Allocator<K>>;
+
+	// Read-only mapping of a whole file, empty if it could not be opened
+	class MappedFile
+	{
+	public:
+		MappedFile() = default;
+		explicit MappedFile(const char* path);
+		MappedFile(const MappedFile&) = delete;
+		MappedFile(MappedFile&& other) noexcept;
+		~MappedFile();
+
+		MappedFile& operator=(const MappedFile&) = delete;
+		MappedFile& operator=(MappedFile&& other) noexcept;
+
+		[[nodiscard]] const std::byte* data() const noexcept { return bytes; }
+		[[nodiscard]] std::size_t size() const noexcept { return length; }
+		[[nodiscard]] bool empty() const noexcept { return length == 0; }
+
+	private:
+		const std::byte* bytes = nullptr;
+		std::size_t length = 0;
+		void* mapping = nullptr;
+
+		void unmap() noexcept;
+	};
+
+	// Shared library whose undefined symbols resolve against the executable, empty if it could not be loaded
+	class SharedLibrary
+	{
+	public:
+		SharedLibrary() = default;
+		explicit SharedLibrary(const char* path);
+		SharedLibrary(const SharedLibrary&) = delete;
+		SharedLibrary(SharedLibrary&& other) noexcept;
+		~SharedLibrary();
+
+		SharedLibrary& operator=(const SharedLibrary&) = delete;
+		SharedLibrary& operator=(SharedLibrary&& other) noexcept;
+
+		[[nodiscard]] bool loaded() const noexcept { return handle != nullptr; }
+
+		// Whether the code or static data at the address belongs to this library
+		[[nodiscard]] bool contains(const void* address) const noexcept;
+
+		void close() noexcept;
+
+	private:
+		void* handle = nullptr;
+
+		// Canonical path the loader knows the library by, which dladdr() reports back on POSIX
+		std::string image;
+	};
+
+	// Changes whenever the running executable is rebuilt, 0 if the platform cannot tell
+	std::uint64_t ExecutableFingerprint();
+
+	// Keeps the calling thread on one logical core, false if the platform or the core refused
+	bool PinThisThread(const std::size_t core); // NOLINT(*-avoid-const-params-in-decls)
 }
 
 #endif //EXTROPY_OS_HPP
\ No newline at end of file
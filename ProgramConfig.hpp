@@ -129,6 +129,12 @@
 
 #define MK_IS_PLATFORM_WEB MK_IS_PLATFORM_EMSCRIPTEN
 
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+	#define MK_IS_ARCH_X86           1
+#else
+	#define MK_IS_ARCH_X86           0
+#endif
+
 // No actual implementation for NDA SDKs
 #define MK_IS_PLATFORM_XB            0
 #define MK_IS_PLATFORM_PS            0
@@ -0,0 +1,71 @@
+// MIT License
+//
+// Copyright (c) 2025 Entropy Embracers LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "Benchmark.hpp"
+
+// A three-argument method call (const Vec&, f64, i32) with its arguments in a Spandle, whose Handles live in the
+// global Heap, against an ArgPack, whose Handles live on the stack
+
+struct Vec { f64 x = 1, y = 2, z = 3; };
+
+struct Body
+{
+	f64 mass = 2;
+
+	[[nodiscard]] f64 mix(const Vec& v, const f64 k, const i32 n) const { return mass * (v.x + v.y + v.z) * k + n; }
+};
+
+META_TYPE(Vec, Meta::AddPOD<Type>());
+META_TYPE(Body, Meta::AddPOD<Type>());
+
+static constexpr u64 kCalls = 1000000;
+
+int main()
+{
+	const Program::Name mix = Program::LiteralName(L"mix");
+
+	Meta::AddMethod<Body, &Body::mix, f64, const Vec&, f64, i32>(mix);
+
+	const Meta::Method method = Meta::GetMethod<Body, const Vec&, f64, i32>(mix);
+	const Meta::Information& body_info = Meta::Info<Body>();
+
+	Body body;
+	Vec v;
+	f64 k = 0.5;
+	i32 n = 1;
+
+	const Meta::View self(&body);
+
+	Program::Assert(method(self, Meta::ArgPack(v, k, n)).as<f64>() == method(self, Meta::Spandle(v, k, n)).as<f64>(), "Benchmark: the packs disagree");
+
+	const double spandle_method = Benchmark::NanosecondsPerCall(kCalls, [&] { return method(self, Meta::Spandle(v, k, n)).as<f64>(); });
+	const double spandle_invoke = Benchmark::NanosecondsPerCall(kCalls, [&] { return Meta::Invoke(body_info, mix, self, Meta::Spandle(v, k, n)).as<f64>(); });
+	const double spandle_build = Benchmark::NanosecondsPerCall(kCalls, [&] { return Meta::Spandle(&v, k, n).size(); });
+
+	const double pack_method = Benchmark::NanosecondsPerCall(kCalls, [&] { return method(self, Meta::ArgPack(v, k, n)).as<f64>(); });
+	const double pack_invoke = Benchmark::NanosecondsPerCall(kCalls, [&] { return Meta::Invoke(body_info, mix, self, Meta::ArgPack(v, k, n)).as<f64>(); });
+	const double pack_build = Benchmark::NanosecondsPerCall(kCalls, [&] { return Meta::ArgPack(&v, k, n).size(); });
+
+	std::wcout << L"Spandle: Method " << spandle_method << L" ns, Invoke " << spandle_invoke << L" ns, building args " << spandle_build << L" ns" << std::endl;
+	std::wcout << L"ArgPack: Method " << pack_method << L" ns, Invoke " << pack_invoke << L" ns, building args " << pack_build << L" ns" << std::endl;
+}
@@ -0,0 +1,52 @@
+// MIT License
+//
+// Copyright (c) 2025 Entropy Embracers LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include "Meta.hpp"
+
+// Shared helpers for the benchmark executables, which reproduce the numbers quoted in the commit log
+namespace Benchmark
+{
+	// Keeps results observable so the optimizer can't drop the measured work
+	inline volatile u64 sink = 0;
+
+	template<typename Body>
+	double NanosecondsPerCall(const u64 calls, Body&& body)
+	{
+		u64 accumulator = 0;
+		const auto start = std::chrono::steady_clock::now();
+		for (u64 call = 0; call < calls; ++call)
+			accumulator += static_cast<u64>(body());
+		const auto elapsed = std::chrono::steady_clock::now() - start;
+		sink = sink + accumulator;
+		return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(calls);
+	}
+
+	inline Program::Name RuntimeName(const std::wstring& text)
+	{
+		return Program::StringName(text.c_str(), text.size());
+	}
+}
@@ -0,0 +1,68 @@
+// MIT License
+//
+// Copyright (c) 2025 Entropy Embracers LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <string>
+#include <vector>
+#include "Benchmark.hpp"
+
+// Find() over every registered runtime name, first through the dynamic name index alone,
+// then with the minimal perfect hash table built in front of it
+
+static constexpr u64 kLookups = 20000000;
+
+static double TimeFind(const std::vector<Program::Name>& names)
+{
+	const u64 rounds = kLookups / names.size();
+	const double per_round = Benchmark::NanosecondsPerCall(rounds, [&]
+	{
+		u64 accumulator = 0;
+		for (const auto& name : names)
+			accumulator += Meta::Find(name);
+		return accumulator;
+	});
+	return per_round / static_cast<double>(names.size());
+}
+
+int main()
+{
+	int round = 0;
+	for (const u64 count : { 32, 1000, 20000 })
+	{
+		++round;
+		std::vector<Program::Name> names;
+		for (u64 i = 0; i < count; ++i)
+			names.push_back(Meta::Register(Benchmark::RuntimeName(L"Module::Namespace::Type" + std::to_wstring(round) + L"_" + std::to_wstring(i)), 4, 4).name);
+
+		const double dynamic = TimeFind(names);
+
+		const auto start = std::chrono::steady_clock::now();
+		Program::Assert(Meta::BuildPerfectNameTable(), "Benchmark: building the perfect name table failed");
+		const double build = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+		for (const auto& name : names)
+			Program::Assert(Meta::GetType(Meta::Find(name))->name == name, "Benchmark: the perfect name table found the wrong type");
+
+		const double perfect = TimeFind(names);
+		std::wcout << count << L" names: dynamic index " << dynamic << L" ns, perfect hash " << perfect << L" ns, build " << build << L" us" << std::endl;
+	}
+}
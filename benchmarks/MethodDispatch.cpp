@@ -0,0 +1,76 @@
+// MIT License
+//
+// Copyright (c) 2025 Entropy Embracers LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "Benchmark.hpp"
+
+// Calling a zero-argument method directly, through GetMethod() by name and through Invoke() by name, and invoking
+// an overload picked by two i32 arguments
+
+struct Shape
+{
+	f64 side = 1;
+
+	[[nodiscard]] f64 area() const { return side * side; }
+};
+
+struct Square : public Shape
+{
+	[[nodiscard]] i32 sum(const i32 a, const i32 b) const { return a + b; }
+	[[nodiscard]] f64 sum(const f64 a) const { return a * 2; }
+};
+
+META_TYPE(Shape, Meta::AddPOD<Type>());
+META_TYPE(Square, Meta::AddPOD<Type>(), Meta::AddInheritance<Type, Shape>());
+
+static constexpr u64 kCalls = 1000000;
+
+int main()
+{
+	const Program::Name area = Program::LiteralName(L"area");
+	const Program::Name sum = Program::LiteralName(L"sum");
+
+	Meta::AddMethod<Shape, &Shape::area, f64>(area);
+	Meta::AddMethod<Square, static_cast<i32 (Square::*)(i32, i32) const>(&Square::sum), i32, i32, i32>(sum);
+	Meta::AddMethod<Square, static_cast<f64 (Square::*)(f64) const>(&Square::sum), f64, f64>(sum);
+
+	Square square;
+	square.side = 3;
+
+	const Meta::View self(&square, Meta::Info<Square>(), Meta::kQualifier_Reference);
+	const Meta::Method direct = Meta::FromMethod<Shape, &Shape::area, f64>();
+	const Meta::Spandle none;
+
+	i32 a = 4;
+	i32 b = 5;
+	const Meta::Spandle two_arguments(a, b);
+
+	const double direct_ns = Benchmark::NanosecondsPerCall(kCalls, [&] { return direct(self, none).as<f64>(); });
+	const double get_method_ns = Benchmark::NanosecondsPerCall(kCalls, [&] { return Meta::GetMethod<Square>(area)(self, none).as<f64>(); });
+	const double invoke_ns = Benchmark::NanosecondsPerCall(kCalls, [&] { return Meta::Invoke(Meta::Info<Square>(), area, self, none).as<f64>(); });
+	const double invoke_arguments_ns = Benchmark::NanosecondsPerCall(kCalls, [&] { return Meta::Invoke(Meta::Info<Square>(), sum, self, two_arguments).as<i32>(); });
+
+	std::wcout << L"direct Method call:         " << direct_ns << L" ns" << std::endl;
+	std::wcout << L"GetMethod by name + call:   " << get_method_ns << L" ns" << std::endl;
+	std::wcout << L"Invoke by name:             " << invoke_ns << L" ns" << std::endl;
+	std::wcout << L"Invoke with two i32:        " << invoke_arguments_ns << L" ns" << std::endl;
+}
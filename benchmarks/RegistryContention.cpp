@@ -0,0 +1,129 @@
+// MIT License
+//
+// Copyright (c) 2025 Entropy Embracers LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Benchmark.hpp"
+#include "OS.hpp"
+
+// Lock-free lookups under contention: reader threads, each pinned to its own core, run GetType, Find, View::is and
+// GetDestructor while a writer registers types with inheritance for the whole window. Per-thread throughput staying
+// flat as threads are added is what lock-free reads should show.
+
+class Foo { public: int x = 20; };
+
+class Bar : public Foo { public: int y = 0; };
+
+META_TYPE(Foo, Meta::AddPOD<Type>());
+META_TYPE(Bar, Meta::AddPOD<Type>(), Meta::AddInheritance<Type, Foo>());
+
+static constexpr auto kDuration = std::chrono::milliseconds(300);
+
+static u64 ReadRegistry(const Program::Name foo_name)
+{
+	static constexpr u64 kBatch = 256;
+
+	u64 accumulator = 0;
+	for (u64 i = 0; i < kBatch; ++i)
+	{
+		Bar bar;
+		accumulator += Meta::GetType(Meta::Info<Bar>().index)->size;
+		accumulator += Meta::Find(foo_name);
+		accumulator += Meta::View(bar).is<Foo>();
+		accumulator += reinterpret_cast<uintptr_t>(Meta::GetDestructor(Meta::Info<Foo>()));
+	}
+	Benchmark::sink = Benchmark::sink + accumulator;
+	return kBatch * 4;
+}
+
+// The only argument, if any, is the most reader threads to run, every core by default
+int main(int argc, char** argv)
+{
+	const Program::Name foo_name = Meta::Info<Foo>().name;
+	const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+	const unsigned max_threads = argc > 1 ? std::max(1, std::atoi(argv[1])) : cores;
+
+	// 1, 2, 4, ... up to the most threads, and that count itself when it isn't a power of two
+	std::vector<unsigned> thread_counts;
+	for (unsigned threads = 1; threads < max_threads; threads *= 2)
+		thread_counts.push_back(threads);
+	thread_counts.push_back(max_threads);
+
+	std::wcout << cores << L" cores" << std::endl;
+
+	u64 registered = 0;
+
+	for (const unsigned threads : thread_counts)
+	{
+		std::atomic<bool> go = false;
+		std::atomic<bool> done = false;
+		std::atomic<u64> total = 0;
+		std::atomic<unsigned> pinned = 0;
+
+		std::vector<std::thread> readers;
+		for (unsigned t = 0; t < threads; ++t)
+			readers.emplace_back([&, t]
+			{
+				pinned += OS::PinThisThread(t % cores);
+
+				while (!go.load()) {}
+				u64 operations = 0;
+				const auto end = std::chrono::steady_clock::now() + kDuration;
+				while (std::chrono::steady_clock::now() < end)
+					operations += ReadRegistry(foo_name);
+				total += operations;
+			});
+
+		// Shares the last reader's core, so a reader is always contending with it
+		u64 writes = 0;
+		std::thread writer([&]
+		{
+			OS::PinThisThread((threads - 1) % cores);
+
+			while (!go.load()) {}
+			while (!done.load())
+			{
+				const auto& info = Meta::Register(Benchmark::RuntimeName(L"Dynamic" + std::to_wstring(registered + writes)), 4, 4);
+				Meta::AddInheritance(const_cast<Meta::Information&>(info), { Meta::Info<Foo>().index });
+				++writes;
+			}
+		});
+
+		go = true;
+		for (auto& reader : readers)
+			reader.join();
+		done = true;
+		writer.join();
+		registered += writes;
+
+		const double seconds = std::chrono::duration<double>(kDuration).count();
+		const double aggregate = static_cast<double>(total) / seconds / 1e6;
+
+		std::wcout << threads << L" threads (" << pinned << L" pinned): " << aggregate << L" Mops/s aggregate, "
+			<< aggregate / threads << L" Mops/s per thread, " << writes << L" types registered meanwhile" << std::endl;
+	}
+}
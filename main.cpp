@@ -12,6 +12,7 @@ META_TYPE(Bar, Meta::AddPOD<Type>(), Meta::AddInheritance<Type, Foo>());
 int main()
 {
 	Meta::DumpInfo();
+	Meta::Freeze();
 
 	auto b = Meta::Handle(true);
 	Meta::Handle b2 = b;
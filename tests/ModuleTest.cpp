@@ -0,0 +1,129 @@
+// MIT License
+//
+// Copyright (c) 2025 Entropy Embracers LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <fstream>
+#include <string>
+#include "ModuleTestTypes.hpp"
+
+// Loads ModuleTestLibrary, whose path is the only argument, unloads it and loads it again
+
+META_TYPE(Foo, Meta::AddPOD<Type>());
+META_TYPE(Bar, Meta::AddPOD<Type>(), Meta::AddInheritance<Type, Foo>());
+
+static int failures = 0;
+
+static void Check(const bool statement, const char* message)
+{
+	if (!statement)
+	{
+		std::wcout << L"FAILED: " << message << std::endl;
+		++failures;
+	}
+}
+
+static bool IsMapped(const std::string& path)
+{
+	std::ifstream maps("/proc/self/maps");
+	std::string line;
+
+	while (std::getline(maps, line))
+	{
+		if (line.find(path) != std::string::npos)
+			return true;
+	}
+
+	return false;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc != 2)
+	{
+		std::wcout << L"Usage: ModuleTest <path to ModuleTestLibrary>" << std::endl;
+		return 2;
+	}
+
+	const std::string path = argv[1];
+	const Meta::Information& foo = Meta::Info<Foo>();
+	const Meta::Information& bar = Meta::Info<Bar>();
+	const Program::Name widget_name = Program::LiteralName(L"Widget");
+
+	Check(!Meta::IsConvertibleTo(foo, bar), "no Foo to Bar converter before the load");
+
+	// The module's type and its converters on core types show up
+	const Meta::ModuleId module = Meta::LoadModule(path.c_str());
+	Check(module != Meta::kInvalidModule, "the module loads");
+	Check(IsMapped(path), "the loaded module is mapped");
+
+	const Meta::Index widget = Meta::Find(widget_name);
+	Check(Meta::Valid(widget), "the module's type is found by name");
+
+	if (!Meta::Valid(widget))
+		return 1;
+
+	const Meta::Information& widget_info = *Meta::GetType(widget);
+	Check(Meta::IsConvertibleTo(foo, bar), "the module's Foo to Bar converter is registered");
+	Check(Meta::IsConvertibleTo(foo, widget_info), "the module's Foo to Widget converter is registered");
+
+	// Unloading fails while a Handle of the module's types is alive
+	{
+		const Meta::Handle handle(widget_info);
+		Check(handle.is<Foo>(), "the module's type derives from Foo");
+		Check(!Meta::UnloadModule(module), "unload refuses while a Handle is alive");
+	}
+
+	// Once released, the library, the name and the converters are gone, but the retired name still prints
+	Check(Meta::UnloadModule(module), "unload succeeds once the Handle is released");
+	Check(!IsMapped(path), "the unloaded module is unmapped");
+	Check(!Meta::Valid(Meta::Find(widget_name)), "the retired type is no longer found by name");
+	Check(Meta::IsRetired(widget_info), "the type is retired");
+	Check(Meta::GetType(widget)->name == widget_name, "the retired type's name still prints");
+	Check(!Meta::IsConvertibleTo(foo, bar), "the module's Foo to Bar converter is dropped");
+	Check(!Meta::IsConvertibleTo(foo, widget_info), "the module's Foo to Widget converter is dropped");
+
+	std::wcout << L"Retired: " << Meta::GetType(widget)->name << std::endl;
+
+	// A reload registers the type again at a fresh index, also found through the perfect name table
+	const Meta::ModuleId again = Meta::LoadModule(path.c_str());
+	Check(again != Meta::kInvalidModule, "the module loads again");
+
+	const Meta::Index reloaded = Meta::Find(widget_name);
+	Check(Meta::Valid(reloaded) && reloaded != widget, "the reloaded type gets a fresh index");
+
+	if (!Meta::Valid(reloaded))
+		return 1;
+
+	{
+		const Meta::Handle handle(*Meta::GetType(reloaded));
+		Check(handle.is<Foo>(), "the reloaded type derives from Foo");
+		Check(Meta::IsConvertibleTo(foo, bar), "the reloaded module's converter is registered");
+	}
+
+	Check(Meta::BuildPerfectNameTable(), "the perfect name table builds");
+	Check(Meta::Find(widget_name) == reloaded, "the perfect name table finds the reloaded type");
+	Check(Meta::UnloadModule(again), "the reloaded module unloads");
+	Check(!Meta::Valid(Meta::Find(widget_name)), "the perfect name table drops the retired type");
+
+	std::wcout << (failures == 0 ? L"All module checks passed" : L"Module checks failed") << std::endl;
+	return failures == 0 ? 0 : 1;
+}